@@ -3,23 +3,75 @@
 
 #include <iostream>
 #include <vector>
+#include <array>
+#include <bit>
+#include <span>
 #include <string>
 #include <string_view>
 #include <istream>
 #include <ostream>
 #include <ranges>
 #include <compare>
+#include <concepts>
+#include <charconv>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <locale>
+#include <utility>
 #include <type_traits>
 #include <limits>
 #include <cstddef>
 #include <cstdint>
+#if __has_include(<format>)
+#include <format>
+#endif
 
 
+// Tuning constants, measured in bigits. Can be overridden by defining them before including
+#ifndef BIG_INT_KARATSUBA_THRESHOLD
+#define BIG_INT_KARATSUBA_THRESHOLD 32 // Smaller operands use long multiplication
+#endif
+#ifndef BIG_INT_TOOM3_THRESHOLD
+#define BIG_INT_TOOM3_THRESHOLD 256 // Smaller operands use Karatsuba
+#endif
+#ifndef BIG_INT_TOOM4_THRESHOLD
+#define BIG_INT_TOOM4_THRESHOLD 768 // Smaller operands use Toom-3 (or Toom-32/Toom-42 if unbalanced)
+#endif
+#ifndef BIG_INT_NTT_THRESHOLD
+#define BIG_INT_NTT_THRESHOLD 2048 // Smaller operands use Toom-Cook
+#endif
+#ifndef BIG_INT_NTT_THRESHOLD_MAX_BASE
+#define BIG_INT_NTT_THRESHOLD_MAX_BASE 6144 // As above, for MAX_BASE, whose native 64 bit long multiplication keeps Toom-Cook faster for longer
+#endif
+#ifndef BIG_INT_DIV_DC_THRESHOLD
+#define BIG_INT_DIV_DC_THRESHOLD 32 // Smaller divisors or quotients use long division
+#endif
+#ifndef BIG_INT_DIV_NEWTON_THRESHOLD
+#define BIG_INT_DIV_NEWTON_THRESHOLD 32768 // Smaller divisors or quotients use Burnikel-Ziegler division
+#endif
+#ifndef BIG_INT_CONVERT_DC_THRESHOLD
+#define BIG_INT_CONVERT_DC_THRESHOLD 32 // Smaller values convert between bases, or to and from strings, by quadratic methods
+#endif
+#ifndef BIG_INT_INLINE_BIGITS
+#define BIG_INT_INLINE_BIGITS 4 // Values of up to this many bigits are kept inside the BigInt, without allocating
+#endif
+
 // Types
 enum class BitwiseType : std::uint8_t
 {
 	AND, OR, XOR
 };
+enum class DivisionType : std::uint8_t
+{
+	TRUNCATED, // Quotient rounds towards zero, remainder takes the dividend's sign (as with built-in integers)
+	FLOORED, // Quotient rounds towards negative infinity, remainder takes the divisor's sign
+	EUCLIDEAN // Remainder is never negative
+};
+enum class ExpressionType : std::uint8_t
+{
+	ADD, SUB, MUL, DIV, MOD
+};
 
 // Base constants
 enum COMMON_BASES : std::uint32_t
@@ -36,35 +88,151 @@ template<typename T> // Used in BigIntConstructible methods to call specialised
 concept INT64Constructible = std::is_convertible_v<T, std::int64_t>;
 template<typename T> // All types that can be passed to the constructor (other than BigInt types)
 concept BigIntConstructible = INT64Constructible<T> || std::is_convertible_v<T, std::string_view>;
+template<typename T> // LazyBigInts and BigIntExpressions, which are evaluated on assignment into a BigInt
+concept LazyBigIntExpression = requires(const T& expr, typename T::big_int_type& dest) {
+	{ expr.refers_to(dest) } -> std::same_as<bool>;
+	expr.eval_to(dest);
+};
+
+template<std::uint32_t base>
+class BigIntView;
+template<ExpressionType type, typename Lhs, typename Rhs>
+class BigIntExpression;
+
+template<typename Allocator = std::allocator<std::uint32_t>>
+class BigitVector
+{ // Contiguous bigits, as std::vector<std::uint32_t, Allocator>, but the first BIG_INT_INLINE_BIGITS are kept inline, so small values never
+  // allocate. Elements past size() aren't kept initialised, so they must be written before they are read
+	static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, std::uint32_t>);
+	using __alloc_traits = std::allocator_traits<Allocator>;
+
+	// Member variables
+	typename __alloc_traits::pointer heap = nullptr; // nullptr while the bigits are inline
+	std::size_t count = 0;
+	std::size_t cap = BIG_INT_INLINE_BIGITS;
+	std::array<std::uint32_t, BIG_INT_INLINE_BIGITS> inline_bigits{};
+	[[no_unique_address]] Allocator alloc;
+
+  public:
+	using value_type = std::uint32_t;
+	using allocator_type = Allocator;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = std::uint32_t&;
+	using const_reference = const std::uint32_t&;
+	using pointer = std::uint32_t*;
+	using const_pointer = const std::uint32_t*;
+	using iterator = std::uint32_t*;
+	using const_iterator = const std::uint32_t*;
+
+	// Constructors
+	constexpr BigitVector() noexcept(noexcept(Allocator())) = default;
+	constexpr explicit BigitVector(const Allocator&) noexcept;
+	constexpr BigitVector(const BigitVector&);
+	constexpr BigitVector(const BigitVector&, const Allocator&);
+	constexpr BigitVector(BigitVector&&) noexcept;
+	constexpr BigitVector(BigitVector&&, const Allocator&);
+	constexpr explicit BigitVector(const std::size_t, const std::uint32_t = 0, const Allocator& = Allocator());
+	constexpr explicit BigitVector(std::span<const std::uint32_t>, const Allocator& = Allocator());
+	template<std::forward_iterator It>
+	constexpr BigitVector(It, It, const Allocator& = Allocator());
+
+	constexpr ~BigitVector();
+
+	// Assignment operators. Allocators propagate as for std::vector
+	constexpr BigitVector& operator=(const BigitVector&);
+	constexpr BigitVector& operator=(BigitVector&&) noexcept(__alloc_traits::propagate_on_container_move_assignment::value ||
+	                                                         __alloc_traits::is_always_equal::value);
+
+	// Comparison operators
+	constexpr bool operator==(const BigitVector&) const noexcept;
+
+	// Element access
+	constexpr std::uint32_t& operator[](const std::size_t) noexcept;
+	constexpr const std::uint32_t& operator[](const std::size_t) const noexcept;
+	constexpr std::uint32_t& front() noexcept;
+	constexpr const std::uint32_t& front() const noexcept;
+	constexpr std::uint32_t& back() noexcept;
+	constexpr const std::uint32_t& back() const noexcept;
+	constexpr std::uint32_t* data() noexcept;
+	constexpr const std::uint32_t* data() const noexcept;
+
+	// Iterators
+	constexpr std::uint32_t* begin() noexcept;
+	constexpr const std::uint32_t* begin() const noexcept;
+	constexpr const std::uint32_t* cbegin() const noexcept;
+	constexpr std::uint32_t* end() noexcept;
+	constexpr const std::uint32_t* end() const noexcept;
+	constexpr const std::uint32_t* cend() const noexcept;
+
+	// Capacity
+	constexpr bool empty() const noexcept;
+	constexpr std::size_t size() const noexcept;
+	constexpr std::size_t capacity() const noexcept;
+	constexpr void reserve(const std::size_t);
 
-template<std::uint32_t base = COMMON_BASES::DEFAULT_BASE> // Base of 0 is equivalent to UINT32_MAX + 1
+	// Modifiers
+	constexpr void clear() noexcept;
+	constexpr void resize(const std::size_t, const std::uint32_t = 0);
+	constexpr void assign(const std::size_t, const std::uint32_t);
+	template<std::forward_iterator It>
+	constexpr void assign(It, It);
+	constexpr void push_back(const std::uint32_t);
+	constexpr void pop_back() noexcept;
+	constexpr std::uint32_t* insert(const std::uint32_t*, const std::size_t, const std::uint32_t);
+	template<std::forward_iterator It>
+	constexpr std::uint32_t* insert(const std::uint32_t*, It, It);
+	constexpr std::uint32_t* erase(const std::uint32_t*, const std::uint32_t*) noexcept;
+	constexpr void swap(BigitVector&) noexcept;
+
+	// Allocator
+	constexpr Allocator get_allocator() const noexcept;
+
+  private:
+	// Helper functions
+	constexpr void __steal(BigitVector&) noexcept;
+	constexpr void __reallocate(const std::size_t);
+	constexpr void __release() noexcept;
+};
+
+template<std::uint32_t base = COMMON_BASES::DEFAULT_BASE, typename Allocator = std::allocator<std::uint32_t>> // Base of 0 is equivalent to UINT32_MAX + 1
 class BigInt
 {
 	static_assert(base != 1); // No unary support
 
 	// Member variables
-	std::vector<std::uint32_t> bigits;
+	BigitVector<Allocator> bigits;
 	bool negative = false; // Can be true or false if value is 0
 
   public:
-	// Friend BigInt instances with different bases
-	template<std::uint32_t other_base>
+	// Friend BigInt instances with different bases and allocators
+	template<std::uint32_t other_base, typename other_allocator>
 	friend class BigInt;
+	template<std::uint32_t any_base>
+	friend class BigIntView;
+	template<ExpressionType any_type, typename any_lhs, typename any_rhs>
+	friend class BigIntExpression;
+
+	using allocator_type = Allocator;
 
 	static constexpr auto BASE_ZERO_TRUE_VALUE = static_cast<std::uint64_t>(std::numeric_limits<std::uint32_t>::max()) + 1;
 
-	// Constructors
+	// Constructors. Those taking an Allocator put the bigits there; the others copy their argument's, or default construct one
 	constexpr BigInt();
+	constexpr explicit BigInt(const std::type_identity_t<Allocator>&);
 	constexpr BigInt(const BigInt&) = default;
+	constexpr BigInt(const BigInt&, const std::type_identity_t<Allocator>&);
 	constexpr BigInt(BigInt&&) = default;
-	constexpr BigInt(const std::int64_t);
-	constexpr BigInt(const std::string_view, const char = 10);
-	constexpr explicit BigInt(const std::vector<std::uint32_t>&, bool);
-	constexpr explicit BigInt(std::vector<std::uint32_t>&&, bool);
+	constexpr BigInt(BigInt&&, const std::type_identity_t<Allocator>&);
+	constexpr BigInt(const std::int64_t, const std::type_identity_t<Allocator>& = Allocator());
+	constexpr BigInt(const std::string_view, const char = 10, const std::type_identity_t<Allocator>& = Allocator());
+	constexpr explicit BigInt(const std::vector<std::uint32_t>&, bool, const std::type_identity_t<Allocator>& = Allocator());
 	template<std::uint32_t other_base>
-	constexpr BigInt(const BigInt<other_base>&);
+	constexpr BigInt(const BigInt<other_base, Allocator>&);
 	template<std::uint32_t other_base>
-	constexpr BigInt(BigInt<other_base>&&);
+	constexpr BigInt(BigInt<other_base, Allocator>&&);
+	template<LazyBigIntExpression Expr> requires std::same_as<typename Expr::big_int_type, BigInt>
+	constexpr BigInt(const Expr&, const std::type_identity_t<Allocator>& = Allocator()); // Evaluates the expression
 
 	constexpr ~BigInt() = default;
 
@@ -73,9 +241,11 @@ class BigInt
 	constexpr BigInt& operator=(BigInt&&) = default;
 	constexpr BigInt& operator=(const BigIntConstructible auto);
 	template<std::uint32_t other_base>
-	constexpr BigInt& operator=(const BigInt<other_base>&);
+	constexpr BigInt& operator=(const BigInt<other_base, Allocator>&);
 	template<std::uint32_t other_base>
-	constexpr BigInt& operator=(BigInt<other_base>&&);
+	constexpr BigInt& operator=(BigInt<other_base, Allocator>&&);
+	template<LazyBigIntExpression Expr> requires std::same_as<typename Expr::big_int_type, BigInt>
+	constexpr BigInt& operator=(const Expr&); // Evaluates the expression into *this, through a temporary if *this is one of its operands
 
 	// Arithmetic-assignment operators
 	constexpr BigInt& operator+=(const BigInt&);
@@ -109,31 +279,66 @@ class BigInt
 	constexpr BigInt& operator<<=(const BigIntConstructible auto);
 	constexpr BigInt& operator>>=(const BigIntConstructible auto);
 
-	// Binary arithmetic operators. Specialisations not required
-	constexpr BigInt operator+(const BigInt&) const;
-	constexpr BigInt operator-(const BigInt&) const;
-	constexpr BigInt operator*(const BigInt&) const;
-	constexpr BigInt operator/(const BigInt&) const;
-	constexpr BigInt operator%(const BigInt&) const;
-	constexpr BigInt operator&(const BigInt&) const;
-	constexpr BigInt operator|(const BigInt&) const;
-	constexpr BigInt operator^(const BigInt&) const;
-	constexpr BigInt operator<<(const BigInt&) const;
-	constexpr BigInt operator>>(const BigInt&) const;
-	constexpr BigInt operator+(const BigIntConstructible auto) const;
-	constexpr BigInt operator-(const BigIntConstructible auto) const;
-	constexpr BigInt operator*(const BigIntConstructible auto) const;
-	constexpr BigInt operator/(const BigIntConstructible auto) const;
-	constexpr BigInt operator%(const BigIntConstructible auto) const;
-	constexpr BigInt operator&(const BigIntConstructible auto) const;
-	constexpr BigInt operator|(const BigIntConstructible auto) const;
-	constexpr BigInt operator^(const BigIntConstructible auto) const;
-	constexpr BigInt operator<<(const BigIntConstructible auto) const;
-	constexpr BigInt operator>>(const BigIntConstructible auto) const;
+	// Binary arithmetic operators. Specialisations not required. An rvalue left operand is reused for the result, as is an rvalue right one for
+	// +, -, *, &, | and ^ when its allocator is equal, so chained expressions allocate as compound assignment would
+	constexpr BigInt operator+(const BigInt&) const&;
+	constexpr BigInt operator+(const BigInt&) &&;
+	constexpr BigInt operator+(BigInt&&) const&;
+	constexpr BigInt operator+(BigInt&&) &&;
+	constexpr BigInt operator-(const BigInt&) const&;
+	constexpr BigInt operator-(const BigInt&) &&;
+	constexpr BigInt operator-(BigInt&&) const&;
+	constexpr BigInt operator-(BigInt&&) &&;
+	constexpr BigInt operator*(const BigInt&) const&;
+	constexpr BigInt operator*(const BigInt&) &&;
+	constexpr BigInt operator*(BigInt&&) const&;
+	constexpr BigInt operator*(BigInt&&) &&;
+	constexpr BigInt operator/(const BigInt&) const&;
+	constexpr BigInt operator/(const BigInt&) &&;
+	constexpr BigInt operator%(const BigInt&) const&;
+	constexpr BigInt operator%(const BigInt&) &&;
+	constexpr BigInt operator&(const BigInt&) const&;
+	constexpr BigInt operator&(const BigInt&) &&;
+	constexpr BigInt operator&(BigInt&&) const&;
+	constexpr BigInt operator&(BigInt&&) &&;
+	constexpr BigInt operator|(const BigInt&) const&;
+	constexpr BigInt operator|(const BigInt&) &&;
+	constexpr BigInt operator|(BigInt&&) const&;
+	constexpr BigInt operator|(BigInt&&) &&;
+	constexpr BigInt operator^(const BigInt&) const&;
+	constexpr BigInt operator^(const BigInt&) &&;
+	constexpr BigInt operator^(BigInt&&) const&;
+	constexpr BigInt operator^(BigInt&&) &&;
+	constexpr BigInt operator<<(const BigInt&) const&;
+	constexpr BigInt operator<<(const BigInt&) &&;
+	constexpr BigInt operator>>(const BigInt&) const&;
+	constexpr BigInt operator>>(const BigInt&) &&;
+	constexpr BigInt operator+(const BigIntConstructible auto) const&;
+	constexpr BigInt operator+(const BigIntConstructible auto) &&;
+	constexpr BigInt operator-(const BigIntConstructible auto) const&;
+	constexpr BigInt operator-(const BigIntConstructible auto) &&;
+	constexpr BigInt operator*(const BigIntConstructible auto) const&;
+	constexpr BigInt operator*(const BigIntConstructible auto) &&;
+	constexpr BigInt operator/(const BigIntConstructible auto) const&;
+	constexpr BigInt operator/(const BigIntConstructible auto) &&;
+	constexpr BigInt operator%(const BigIntConstructible auto) const&;
+	constexpr BigInt operator%(const BigIntConstructible auto) &&;
+	constexpr BigInt operator&(const BigIntConstructible auto) const&;
+	constexpr BigInt operator&(const BigIntConstructible auto) &&;
+	constexpr BigInt operator|(const BigIntConstructible auto) const&;
+	constexpr BigInt operator|(const BigIntConstructible auto) &&;
+	constexpr BigInt operator^(const BigIntConstructible auto) const&;
+	constexpr BigInt operator^(const BigIntConstructible auto) &&;
+	constexpr BigInt operator<<(const BigIntConstructible auto) const&;
+	constexpr BigInt operator<<(const BigIntConstructible auto) &&;
+	constexpr BigInt operator>>(const BigIntConstructible auto) const&;
+	constexpr BigInt operator>>(const BigIntConstructible auto) &&;
 	
 	// Unary operators
-	constexpr BigInt operator+() const;
-	constexpr BigInt operator-() const;
+	constexpr BigInt operator+() const&;
+	constexpr BigInt operator+() &&;
+	constexpr BigInt operator-() const&;
+	constexpr BigInt operator-() &&;
 	constexpr BigInt operator~() const;
 	constexpr explicit operator bool() const noexcept;
 	constexpr BigInt& operator++();
@@ -159,11 +364,13 @@ class BigInt
 	constexpr bool positive() const noexcept;
 	constexpr BigInt& sign(const bool) noexcept;
 	constexpr bool is_zero() const noexcept;
-	constexpr BigInt clone() const;
-	constexpr void swap(BigInt&) noexcept;
-	constexpr const std::vector<std::uint32_t>& data() const noexcept;
+	constexpr BigInt clone() const; // Unlike the copy constructor, keeps the allocator
+	constexpr void swap(BigInt&) noexcept; // O(1). As for std::vector, unless the allocator propagates on swap, both must be equal
+	constexpr std::span<const std::uint32_t> data() const noexcept;
+	constexpr Allocator get_allocator() const noexcept;
 
 	constexpr BigInt& abs() noexcept;
+	constexpr BigInt& square();
 	constexpr BigInt& sqrt();
 	constexpr BigInt& log(const BigInt&);
 	constexpr BigInt& log(const std::int64_t); // Specialisation: log without construction
@@ -175,6 +382,10 @@ class BigInt
 	constexpr BigInt& gcd(const BigIntConstructible auto);
 	constexpr BigInt& lcm(const BigInt&);
 	constexpr BigInt& lcm(const BigIntConstructible auto);
+	template<DivisionType type = DivisionType::TRUNCATED>
+	constexpr BigInt& div_rem(const BigInt&, BigInt&); // Quotient is stored in *this, remainder in the second argument
+	template<DivisionType type = DivisionType::TRUNCATED>
+	constexpr BigInt& div_rem(const BigIntConstructible auto, BigInt&);
 	constexpr BigInt& factorial();
 
 	constexpr std::uint64_t bits() const;
@@ -182,30 +393,127 @@ class BigInt
 	constexpr std::uint64_t digit_sum(std::uint32_t = 10) const;
 	constexpr std::int64_t to_int() const;
 	constexpr std::string str(const char = 10) const;
+	constexpr std::size_t chars_needed(const int = 10) const; // Upper bound on the chars written by to_chars
+	constexpr std::to_chars_result to_chars(char*, char*, const int = 10) const; // As std::to_chars, writing the same chars as str
+	constexpr std::size_t serialized_size() const noexcept;
+	constexpr std::size_t serialize(std::span<std::byte>) const;
+	template<std::output_iterator<char> It> // As std::format_to with "{:spec}", see format_functions.hpp for the spec
+	It format_to(It, const std::string_view = {}, const std::locale& = std::locale()) const;
 
 	// Friend functions
-	template<std::uint32_t any_base>
-	friend std::ostream& operator<<(std::ostream&, const BigInt<any_base>&);
-	template<std::uint32_t any_base>
-	friend std::istream& operator>>(std::istream&, BigInt<any_base>&);
+	template<std::uint32_t any_base, typename any_allocator>
+	friend std::ostream& operator<<(std::ostream&, const BigInt<any_base, any_allocator>&);
+	template<std::uint32_t any_base, typename any_allocator>
+	friend std::istream& operator>>(std::istream&, BigInt<any_base, any_allocator>&);
+	template<std::uint32_t any_base, typename any_allocator>
+	friend constexpr std::from_chars_result from_chars(const char*, const char*, BigInt<any_base, any_allocator>&, const int);
+#ifdef __cpp_lib_format
+	template<typename, typename>
+	friend struct std::formatter;
+#endif
 
 	// Static functions: public
 	static constexpr std::uint64_t true_base() noexcept;
+	static constexpr BigInt deserialize(std::span<const std::byte>, const Allocator& = Allocator());
 
   private:
 	// Static functions: private
 	static constexpr std::size_t __int_size(const std::int64_t) noexcept;
 	static constexpr std::uint8_t __int_log_of(std::uint64_t, std::uint64_t) noexcept;
+	static constexpr std::uint64_t __max_pow_in_bigit(const std::uint64_t, std::uint8_t&) noexcept;
+	static constexpr std::uint64_t __common_root(std::uint64_t, std::uint64_t) noexcept;
+	static constexpr void __store_le(std::span<std::byte>, std::uint64_t) noexcept;
+	static constexpr std::uint64_t __load_le(std::span<const std::byte>) noexcept;
+	static constexpr std::span<const std::byte> __serialized_bigits(std::span<const std::byte>, std::uint32_t&, bool&);
+	struct __FormatSpec;
+	static constexpr __FormatSpec __parse_format_spec(const std::string_view);
 	static constexpr bool __valid_char(const char, const char = 10);
 	static constexpr char __char_value(const char, const char = 10);
+	static constexpr std::uint32_t __chars_value(std::string_view, const char = 10);
+	static bool __eight_digits_value(const char*, std::uint32_t&) noexcept;
 	static constexpr char __value_to_char(const char, const char = 10);
-	static constexpr std::string __constexpr_to_string(std::int64_t, const char = 10); // NOTE: constexpr version of std::to_string
 	static constexpr std::uint64_t __constexpr_abs(const std::int64_t) noexcept; // NOTE: constexpr version of std::abs
+	static constexpr std::uint32_t __inverse_mod_base(const std::uint32_t) noexcept;
+	static constexpr std::uint32_t __pow_mod(std::uint64_t, std::uint64_t, const std::uint32_t) noexcept;
+	static constexpr std::uint64_t __mul_wide(const std::uint64_t, const std::uint64_t, std::uint64_t&) noexcept;
+	static constexpr std::uint64_t __reciprocal_2by1(const std::uint64_t) noexcept;
+	static constexpr std::uint64_t __div_2by1(const std::uint64_t, const std::uint64_t, const std::uint64_t, const std::uint64_t, std::uint64_t&) noexcept;
+
+	// Static functions: bigit kernels, operating on little-endian bigit spans
+	static constexpr std::uint32_t __add_bigits(std::span<std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr std::uint32_t __sub_bigits(std::span<std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr std::uint32_t __shl_bigits(std::span<std::uint32_t>, std::span<const std::uint32_t>, const std::uint8_t) noexcept;
+	static constexpr void __shr_bigits(std::span<std::uint32_t>, const std::uint8_t) noexcept;
+	static constexpr std::uint32_t __mul_bigits_small(std::span<std::uint32_t>, const std::uint32_t) noexcept;
+	static constexpr std::uint64_t __div_bigits_small(std::span<std::uint32_t>, const std::uint64_t) noexcept;
+	static constexpr std::span<const std::uint32_t> __trim_bigits(std::span<const std::uint32_t>) noexcept;
+	static constexpr bool __valid_bigits(std::span<const std::uint32_t>) noexcept;
+	static constexpr std::strong_ordering __compare_bigits(std::span<const std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr BigInt __from_bigits(std::span<const std::uint32_t>, const Allocator& = Allocator());
+	template<std::uint32_t other_base>
+	static constexpr BigInt __from_base(std::span<const std::uint32_t>, const Allocator& = Allocator());
+	static constexpr BigInt __from_radix(std::span<const std::uint32_t>, const std::uint64_t, const Allocator& = Allocator());
+	static constexpr BigInt __from_radix_dc(std::span<const std::uint32_t>, const std::uint64_t, std::span<const BigInt>, const Allocator& = Allocator());
+	static constexpr void __mul_bigits(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr std::size_t __mul_scratch_size(const std::size_t, const std::size_t) noexcept;
+	static constexpr void __mul_bigits_long(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr void __addmul_bigits_long(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr bool __submul_bigits_long(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr void __sqr_bigits(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr void __sqr_bigits_long(std::span<std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr void __sqr_bigits_karatsuba(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr void __mul_bigits_chunked(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr void __mul_bigits_karatsuba(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr void __mul_bigits_toom(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	template<std::size_t a_parts, std::size_t b_parts>
+	static constexpr void __mul_bigits_toom(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, const std::size_t, std::span<std::uint32_t>);
+	template<std::size_t points>
+	static constexpr void __toom_interpolate(std::array<std::span<std::uint32_t>, points>&, std::array<bool, points>&, std::span<std::uint32_t>) noexcept;
+	static constexpr std::size_t __toom_eval_size(const std::size_t) noexcept;
+	static constexpr std::size_t __toom_scratch_size(const std::size_t, const std::size_t) noexcept;
+	static constexpr void __add_signed_bigits(std::span<std::uint32_t>, bool&, std::span<const std::uint32_t>, const bool) noexcept;
+	static constexpr void __negate_bigits(std::span<std::uint32_t>) noexcept;
+	template<std::uint32_t divisor>
+	static constexpr void __div_exact_bigits(std::span<std::uint32_t>) noexcept;
+	static constexpr void __mul_bigits_ntt(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	template<std::uint32_t mod, std::uint32_t root>
+	static constexpr void __ntt_convolve(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	template<std::uint32_t mod, std::uint32_t root>
+	static constexpr void __ntt(std::span<std::uint32_t>, const bool, std::span<std::uint32_t>);
+	static constexpr void __div_bigits(std::span<std::uint32_t>, std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr std::size_t __div_scratch_size(const std::size_t, const std::size_t) noexcept;
+	static constexpr void __div_bigits_long(std::span<std::uint32_t>, std::span<std::uint32_t>, std::span<const std::uint32_t>) noexcept;
+	static constexpr void __div_bigits_dc(std::span<std::uint32_t>, std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr std::size_t __div_dc_scratch_size(const std::size_t, const std::size_t) noexcept;
+	static constexpr void __div_bigits_newton(std::span<std::uint32_t>, std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr std::size_t __div_newton_scratch_size(const std::size_t, const std::size_t) noexcept;
+	static constexpr void __reciprocal_bigits(std::span<std::uint32_t>, std::span<const std::uint32_t>, std::span<std::uint32_t>);
+	static constexpr std::size_t __reciprocal_scratch_size(const std::size_t) noexcept;
+
+	// Static helper types
+	using __BigIntVector = std::vector<BigInt, typename std::allocator_traits<Allocator>::template rebind_alloc<BigInt>>; // Allocated like the bigits
+	struct __FormatSpec
+	{
+		char fill = ' ', align = '\0', sign = '-', group = '\0', type = 'd';
+		bool alternate = false, zero_pad = false;
+		std::size_t width = 0;
+	};
 
 	// Static helper constants
 	static constexpr auto __LESS_SO = std::strong_ordering::less;
 	static constexpr auto __GREATER_SO = std::strong_ordering::greater;
 	static constexpr auto __EQUAL_SO = std::strong_ordering::equal;
+	static constexpr std::size_t __KARATSUBA_THRESHOLD = BIG_INT_KARATSUBA_THRESHOLD;
+	static constexpr std::size_t __TOOM3_THRESHOLD = BIG_INT_TOOM3_THRESHOLD;
+	static constexpr std::size_t __TOOM4_THRESHOLD = BIG_INT_TOOM4_THRESHOLD;
+	static constexpr std::size_t __NTT_THRESHOLD = base == MAX_BASE ? BIG_INT_NTT_THRESHOLD_MAX_BASE : BIG_INT_NTT_THRESHOLD;
+	static constexpr std::size_t __DIV_DC_THRESHOLD = BIG_INT_DIV_DC_THRESHOLD;
+	static constexpr std::size_t __DIV_NEWTON_THRESHOLD = BIG_INT_DIV_NEWTON_THRESHOLD;
+	static constexpr std::size_t __CONVERT_DC_THRESHOLD = BIG_INT_CONVERT_DC_THRESHOLD;
+	static constexpr std::uint32_t __NTT_MOD1 = 3'221'225'473, __NTT_ROOT1 = 5; // 3 * 2^30 + 1
+	static constexpr std::uint32_t __NTT_MOD2 = 3'489'660'929, __NTT_ROOT2 = 3; // 13 * 2^28 + 1
+	static constexpr std::uint32_t __NTT_MOD3 = 3'892'314'113, __NTT_ROOT3 = 3; // 29 * 2^27 + 1
+	static constexpr std::size_t __NTT_MAX_SIZE = std::size_t{ 1 } << 27; // Largest power of 2 dividing every __NTT_MOD - 1
 	static constexpr auto __REV_V = std::views::reverse;
 	static constexpr auto __DROP1_V = std::views::drop(1);
 	static constexpr auto __REV_DROP1_V = __REV_V | __DROP1_V;
@@ -221,18 +529,59 @@ class BigInt
 	static constexpr auto __THROW_INT64_UNDERFLOW = "Underflowed when converting to int64_t";
 	static constexpr auto __THROW_CHAR_INVALID = "Invalid char used";
 	static constexpr auto __THROW_VALUE_TO_CHAR_INVALID = "Invalid value used (must be less than sv_base)";
+	static constexpr auto __THROW_SERIALIZE_SIZE_DOMAIN = "Buffer too small to serialize into (see serialized_size)";
+	static constexpr auto __THROW_DESERIALIZE_INVALID = "Invalid serialized BigInt";
+	static constexpr auto __THROW_FORMAT_SPEC_INVALID = "Invalid format spec";
+	static constexpr auto __THROW_VIEW_SERIALIZED_DOMAIN = "Can only view serialized bigits of the same base, aligned, on a little-endian host";
+	static constexpr std::array<char, 4> __SERIAL_MAGIC{ 'B', 'i', 'g', 'I' };
+	static constexpr std::uint8_t __SERIAL_VERSION = 1;
+	static constexpr std::size_t __SERIAL_HEADER_SIZE = 20; // Magic, version, sign, 2 reserved bytes, base, bigit count
+	static constexpr std::string_view __DIGIT_CHARS = "0123456789abcdefghijklmnopqrstuvwxyz";
+	static constexpr auto __DIGIT_PAIRS = [] { // "00", "01", ..., "99", back to back
+		std::array<char, 200> pairs{};
+		for(std::size_t i = 0; i != 100; ++i) {
+			pairs[2 * i] = static_cast<char>('0' + i / 10);
+			pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+		}
+		return pairs;
+	}();
+	static constexpr auto __HEX_PAIRS = [] { // "00", "01", ..., "ff", back to back
+		std::array<char, 512> pairs{};
+		for(std::size_t i = 0; i != 256; ++i) {
+			pairs[2 * i] = __DIGIT_CHARS[i / 16];
+			pairs[2 * i + 1] = __DIGIT_CHARS[i % 16];
+		}
+		return pairs;
+	}();
 
 	// Helper functions
 	constexpr BigInt& __sqrt_helper();
 	constexpr BigInt& __gcd_helper(const BigInt&);
+	static constexpr char* __put_bigit(char*, std::uint32_t, const int, std::uint8_t) noexcept;
+	static constexpr char* __to_chars_power(char*, char*, std::span<const std::uint32_t>, const int, const std::uint8_t) noexcept;
+	static constexpr char* __to_chars_short(char*, char*, std::span<std::uint32_t>, const int, const std::size_t);
+	static constexpr char* __to_chars_helper(char*, char*, BigInt, const int, std::span<const BigInt>, const std::size_t);
+	static bool __put_block(std::streambuf&, char*, char*, const bool);
+	template<typename Sink>
+	static bool __put_chars_helper(Sink&, BigInt, const int, std::span<const BigInt>, const std::size_t, std::string&);
+	template<typename Sink>
+	bool __put_chars(Sink&, const int) const; // Sink is called as bool(char*, char*) with each block of chars, in order
 	constexpr BigInt& __not_helper();
 	template<BitwiseType type = BitwiseType::AND>
 	constexpr BigInt& __bitwise_signless(const BigInt&);
 	constexpr BigInt& __add_eq_signless(const BigInt&);
 	constexpr BigInt& __sub_eq_signless(const BigInt&);
 	constexpr BigInt& __mul_eq_signless(const BigInt&);
+	constexpr BigInt& __mul_eq_signless(const BigInt&, BigitVector<Allocator>&, BigitVector<Allocator>&);
+	constexpr BigInt& __sqr_eq_signless();
+	constexpr BigInt& __sqr_eq_signless(BigitVector<Allocator>&, BigitVector<Allocator>&);
+	constexpr BigInt& __mul_of(const BigInt&, const BigInt&);
+	constexpr BigInt& __addmul_eq(const BigInt&, const BigInt&, const bool = false);
+	constexpr BigInt& __mulmod_of(const BigInt&, const BigInt&, const std::int64_t);
+	constexpr std::size_t __pow_size(const std::uint64_t) const noexcept;
 	template<bool remainder = false>
 	constexpr BigInt& __div_mod_eq_signless(const BigInt&);
+	constexpr BigInt& __div_rem_eq_signless(const BigInt&, BigInt&);
 	constexpr BigInt& __shl_eq_signless(const BigInt&);
 	constexpr BigInt& __shr_eq_signless(const BigInt&);
 	template<bool right = false>
@@ -245,6 +594,7 @@ class BigInt
 	constexpr BigInt& __mul_eq_signless(const std::uint64_t);
 	template<bool remainder = false>
 	constexpr BigInt& __div_mod_eq_signless(const std::uint64_t);
+	constexpr BigInt& __div_rem_eq_signless(const std::uint64_t, std::uint64_t&);
 	constexpr BigInt& __shl_eq_signless(const std::uint64_t);
 	constexpr BigInt& __shr_eq_signless(const std::uint64_t);
 	template<bool right = false>
@@ -263,14 +613,192 @@ class BigInt
 	constexpr const std::uint32_t& back() const;
 };
 
-// External functions
 template<std::uint32_t base = COMMON_BASES::DEFAULT_BASE>
-constexpr BigInt<base> make_big_int(const BigIntConstructible auto);
+class BigIntView
+{ // Non-owning, read-only view of valid bigits kept elsewhere (e.g. in a memory-mapped file). Every result is a BigInt
+	// Member variables
+	std::span<const std::uint32_t> bigits;
+	bool negative = false;
+
+	static constexpr std::array<std::uint32_t, 1> __ZERO_BIGITS{};
+
+  public:
+	// Constructors
+	constexpr BigIntView() noexcept;
+	template<typename Allocator> // Not explicit, so BigInts can be passed wherever a BigIntView is taken
+	constexpr BigIntView(const BigInt<base, Allocator>&) noexcept;
+	constexpr explicit BigIntView(std::span<const std::uint32_t>, bool);
+
+	// Binary arithmetic operators
+	constexpr BigInt<base> operator+(const BigIntView&) const;
+	constexpr BigInt<base> operator-(const BigIntView&) const;
+	constexpr BigInt<base> operator*(const BigIntView&) const;
+	constexpr BigInt<base> operator/(const BigIntView&) const;
+	constexpr BigInt<base> operator%(const BigIntView&) const;
+
+	// Comparison operators
+	constexpr bool operator==(const BigIntView&) const noexcept;
+	constexpr std::strong_ordering operator<=>(const BigIntView&) const noexcept;
+
+	// Member functions
+	constexpr std::size_t size() const noexcept;
+	constexpr bool positive() const noexcept;
+	constexpr bool is_zero() const noexcept;
+	constexpr BigInt<base> clone() const; // Copies the bigits into an owning BigInt
+	constexpr std::span<const std::uint32_t> data() const noexcept;
+	constexpr std::string str(const char = 10) const;
+	constexpr std::size_t chars_needed(const int = 10) const;
+	constexpr std::to_chars_result to_chars(char*, char*, const int = 10) const;
+
+	// Static functions: public
+	static BigIntView view_serialized(std::span<const std::byte>); // Views the bigits written by BigInt::serialize in place
+};
+
+template<std::uint32_t base = COMMON_BASES::DEFAULT_BASE, typename Allocator = std::allocator<std::uint32_t>>
+class LazyBigInt
+{ // Leaf of a BigIntExpression, made by lazy(). Refers to a BigInt, which must outlive the expressions built from it
+	// Member variables
+	const BigInt<base, Allocator>& value;
+
+  public:
+	using big_int_type = BigInt<base, Allocator>;
+
+	// Constructors
+	constexpr explicit LazyBigInt(const BigInt<base, Allocator>&) noexcept;
+
+	// Member functions
+	constexpr const BigInt<base, Allocator>& get() const noexcept;
+	constexpr bool refers_to(const BigInt<base, Allocator>&) const noexcept;
+	constexpr void eval_to(BigInt<base, Allocator>&) const;
+};
+
+template<ExpressionType type, typename Lhs, typename Rhs>
+class BigIntExpression
+{ // Lazy lhs op rhs. Lhs is a LazyBigInt or BigIntExpression, Rhs either of those or an std::int64_t. Nothing is calculated until it is
+  // assigned to a BigInt, which evaluates the whole tree into its own bigits. c + a * b, c - a * b, a * b + c * d and (a * b) % m, where a, b,
+  // c and d are BigInts, are fused: the product is accumulated straight into the result, or isn't built at all
+	static_assert(LazyBigIntExpression<Lhs> && (LazyBigIntExpression<Rhs> || std::is_same_v<Rhs, std::int64_t>));
+
+	// Member variables
+	Lhs lhs;
+	Rhs rhs;
+
+	template<ExpressionType any_type, typename any_lhs, typename any_rhs>
+	friend class BigIntExpression;
+
+  public:
+	using big_int_type = typename Lhs::big_int_type;
+
+	// Constructors
+	constexpr BigIntExpression(const Lhs&, const Rhs&);
+
+	// Member functions
+	constexpr bool refers_to(const big_int_type&) const noexcept;
+	constexpr void eval_to(big_int_type&) const; // Overwrites the argument, which mustn't be referred to
+
+  private:
+	// Static helper constants
+	template<typename T>
+	static constexpr bool __IS_LEAF = requires(const T& operand) {
+		{ operand.get() } -> std::same_as<const big_int_type&>;
+	};
+	template<typename T>
+	static constexpr bool __IS_PRODUCT = requires { requires T::__PRODUCT; };
+	static constexpr bool __PRODUCT = type == ExpressionType::MUL && __IS_LEAF<Lhs> && __IS_LEAF<Rhs>; // Of two BigInts: can be fused
+
+	// Helper functions
+	template<typename T>
+	static constexpr void __eval_operand(const T&, big_int_type&);
+	template<typename T>
+	static constexpr void __apply(big_int_type&, const T&);
+};
+
+#ifdef __cpp_lib_format
+template<std::uint32_t base, typename Allocator>
+struct std::formatter<BigInt<base, Allocator>, char>
+{ // Takes the same specs as BigInt::format_to
+	std::string_view spec;
+
+	constexpr std::format_parse_context::iterator parse(std::format_parse_context&);
+	template<typename FormatContext>
+	typename FormatContext::iterator format(const BigInt<base, Allocator>&, FormatContext&) const;
+};
+#endif
+
+// External functions
+template<std::uint32_t base = COMMON_BASES::DEFAULT_BASE, typename Allocator = std::allocator<std::uint32_t>>
+constexpr BigInt<base, Allocator> make_big_int(const BigIntConstructible auto, const Allocator& = Allocator());
+template<std::uint32_t base, typename Allocator>
+constexpr std::from_chars_result from_chars(const char*, const char*, BigInt<base, Allocator>&, const int = 10); // As std::from_chars
+template<DivisionType type = DivisionType::TRUNCATED, std::uint32_t base, typename Allocator>
+constexpr std::pair<BigInt<base, Allocator>, BigInt<base, Allocator>> divmod(BigInt<base, Allocator>, const BigInt<base, Allocator>&); // Returns { quotient, remainder }
+template<DivisionType type = DivisionType::TRUNCATED, std::uint32_t base, typename Allocator>
+constexpr std::pair<BigInt<base, Allocator>, BigInt<base, Allocator>> divmod(BigInt<base, Allocator>, const BigIntConstructible auto);
+template<std::uint32_t base, typename Allocator>
+constexpr void swap(BigInt<base, Allocator>&, BigInt<base, Allocator>&) noexcept; // As the member, for std::ranges::swap
+template<std::uint32_t base>
+constexpr BigInt<base> operator+(const BigInt<base>&, const BigIntView<base>);
+template<std::uint32_t base>
+constexpr BigInt<base> operator-(const BigInt<base>&, const BigIntView<base>);
+template<std::uint32_t base>
+constexpr BigInt<base> operator*(const BigInt<base>&, const BigIntView<base>);
+template<std::uint32_t base>
+constexpr BigInt<base> operator/(const BigInt<base>&, const BigIntView<base>);
+template<std::uint32_t base>
+constexpr BigInt<base> operator%(const BigInt<base>&, const BigIntView<base>);
+template<std::uint32_t base, typename Allocator>
+constexpr LazyBigInt<base, Allocator> lazy(const BigInt<base, Allocator>&) noexcept; // Starts a BigIntExpression, e.g. BigInt<> r = lazy(a) * b + c
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::ADD, Lhs, Rhs> operator+(const Lhs&, const Rhs&);
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::ADD, Lhs, LazyBigInt<base, Allocator>> operator+(const Lhs&, const BigInt<base, Allocator>&);
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::ADD, LazyBigInt<base, Allocator>, Rhs> operator+(const BigInt<base, Allocator>&, const Rhs&);
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::ADD, Lhs, std::int64_t> operator+(const Lhs&, const std::int64_t);
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::SUB, Lhs, Rhs> operator-(const Lhs&, const Rhs&);
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::SUB, Lhs, LazyBigInt<base, Allocator>> operator-(const Lhs&, const BigInt<base, Allocator>&);
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::SUB, LazyBigInt<base, Allocator>, Rhs> operator-(const BigInt<base, Allocator>&, const Rhs&);
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::SUB, Lhs, std::int64_t> operator-(const Lhs&, const std::int64_t);
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::MUL, Lhs, Rhs> operator*(const Lhs&, const Rhs&);
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MUL, Lhs, LazyBigInt<base, Allocator>> operator*(const Lhs&, const BigInt<base, Allocator>&);
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MUL, LazyBigInt<base, Allocator>, Rhs> operator*(const BigInt<base, Allocator>&, const Rhs&);
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::MUL, Lhs, std::int64_t> operator*(const Lhs&, const std::int64_t);
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::DIV, Lhs, Rhs> operator/(const Lhs&, const Rhs&);
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::DIV, Lhs, LazyBigInt<base, Allocator>> operator/(const Lhs&, const BigInt<base, Allocator>&);
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::DIV, LazyBigInt<base, Allocator>, Rhs> operator/(const BigInt<base, Allocator>&, const Rhs&);
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::DIV, Lhs, std::int64_t> operator/(const Lhs&, const std::int64_t);
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::MOD, Lhs, Rhs> operator%(const Lhs&, const Rhs&);
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MOD, Lhs, LazyBigInt<base, Allocator>> operator%(const Lhs&, const BigInt<base, Allocator>&);
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MOD, LazyBigInt<base, Allocator>, Rhs> operator%(const BigInt<base, Allocator>&, const Rhs&);
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::MOD, Lhs, std::int64_t> operator%(const Lhs&, const std::int64_t);
 constexpr BigInt<> operator""_bi(std::uint64_t);
 constexpr BigInt<> operator""_big_int(std::uint64_t);
 constexpr BigInt<> operator""_bi(const char*, std::size_t);
 constexpr BigInt<> operator""_big_int(const char*, std::size_t);
 
+namespace pmr
+{ // BigInts whose bigits come from a std::pmr::memory_resource, e.g. a std::pmr::monotonic_buffer_resource
+template<std::uint32_t base = COMMON_BASES::DEFAULT_BASE>
+using BigInt = ::BigInt<base, std::pmr::polymorphic_allocator<std::uint32_t>>;
+} // namespace pmr
+
 
 #endif // BIG_INT_HPP
 
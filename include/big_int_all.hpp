@@ -1,14 +1,18 @@
 #include "big_int.hpp"
 #include "def/arithmetic_assignment_operators.hpp"
 #include "def/assignment_operators.hpp"
+#include "def/bigit_vector_functions.hpp"
 #include "def/binary_arithmetic_operators.hpp"
 #include "def/comparison_operators.hpp"
 #include "def/constructors.hpp"
+#include "def/expression_functions.hpp"
 #include "def/external_functions.hpp"
+#include "def/format_functions.hpp"
 #include "def/friend_functions.hpp"
 #include "def/helper_functions.hpp"
 #include "def/member_functions.hpp"
 #include "def/static_functions.hpp"
 #include "def/unary_operators.hpp"
 #include "def/utility_functions.hpp"
+#include "def/view_functions.hpp"
 
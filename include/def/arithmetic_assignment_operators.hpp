@@ -11,48 +11,40 @@
 #include "helper_functions.hpp"
 #include "external_functions.hpp"
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator+=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator+=(const BigInt<base, Allocator>& other)
 {
 	if(other.is_zero())
 		return *this;
-	else if(positive() != other.positive()) {
-		if(is_zero()) {
-			*this = other;
-			negative = positive();
-			return *this;
-		}
+	else if(is_zero())
+		return *this = other;
+	else if(positive() != other.positive())
 		return __sub_eq_signless(other);
-	} else {
-		if(is_zero())
-			return *this = other;
+	else
 		return __add_eq_signless(other);
-	}
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator-=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator-=(const BigInt<base, Allocator>& other)
 {
 	if(other.is_zero())
 		return *this;
-	else if(positive() != other.positive()) {
-		if(is_zero())
-			return *this = other;
+	else if(is_zero()) {
+		*this = other;
+		negative = positive();
+		return *this;
+	} else if(positive() != other.positive())
 		return __add_eq_signless(other);
-	} else {
-		if(is_zero()) {
-			*this = other;
-			negative = positive();
-			return *this;
-		}
+	else
 		return __sub_eq_signless(other);
-	}
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator*=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator*=(const BigInt<base, Allocator>& other)
 {
-	if(is_zero() || other == 1)
+	if(&other == this) // Self-aliasing: x *= x
+		return square();
+	else if(is_zero() || other == 1)
 		return *this;
 	else if(other == -1) {
 		negative = positive();
@@ -69,8 +61,8 @@ constexpr BigInt<base>& BigInt<base>::operator*=(const BigInt<base>& other)
 	return __mul_eq_signless(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator/=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator/=(const BigInt<base, Allocator>& other)
 {
 	if(other.is_zero())
 		throw std::domain_error(__THROW_DIVIDE_ZERO_DOMAIN);
@@ -86,8 +78,8 @@ constexpr BigInt<base>& BigInt<base>::operator/=(const BigInt<base>& other)
 	return __div_mod_eq_signless<false>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator%=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator%=(const BigInt<base, Allocator>& other)
 {
 	if(other.is_zero())
 		throw std::domain_error(__THROW_DIVIDE_ZERO_DOMAIN);
@@ -99,8 +91,8 @@ constexpr BigInt<base>& BigInt<base>::operator%=(const BigInt<base>& other)
 	return __div_mod_eq_signless<true>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator&=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator&=(const BigInt<base, Allocator>& other)
 {
 	const auto neg = !positive() || !other.positive();
 	if(is_zero()) {
@@ -116,8 +108,8 @@ constexpr BigInt<base>& BigInt<base>::operator&=(const BigInt<base>& other)
 	return __bitwise_signless<BitwiseType::AND>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator|=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator|=(const BigInt<base, Allocator>& other)
 {
 	const auto neg = !positive() && !other.positive();
 	if(other.is_zero()) {
@@ -133,8 +125,8 @@ constexpr BigInt<base>& BigInt<base>::operator|=(const BigInt<base>& other)
 	return __bitwise_signless<BitwiseType::OR>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator^=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator^=(const BigInt<base, Allocator>& other)
 {
 	const auto neg = positive() == other.positive();
 	if(other.is_zero()) {
@@ -150,58 +142,48 @@ constexpr BigInt<base>& BigInt<base>::operator^=(const BigInt<base>& other)
 	return __bitwise_signless<BitwiseType::XOR>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator<<=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator<<=(const BigInt<base, Allocator>& other)
 {
 	return __shl_shr_eq_helper<false>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator>>=(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator>>=(const BigInt<base, Allocator>& other)
 {
 	return __shl_shr_eq_helper<true>(other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator+=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator+=(const std::int64_t other)
 {
 	if(other == 0)
 		return *this;
-	else if(positive() != (other >= 0)) {
-		if(is_zero()) {
-			*this = other;
-			negative = positive();
-			return *this;
-		}
+	else if(is_zero())
+		return *this = other;
+	else if(positive() != (other >= 0))
 		return __sub_eq_signless(__constexpr_abs(other)); // Specialisation
-	} else {
-		if(is_zero())
-			return *this = other;
+	else
 		return __add_eq_signless(__constexpr_abs(other)); // Specialisation
-	}
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator-=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator-=(const std::int64_t other)
 {
 	if(other == 0)
 		return *this;
-	else if(positive() != (other >= 0)) {
-		if(is_zero())
-			return *this = other;
+	else if(is_zero()) {
+		*this = other;
+		negative = positive();
+		return *this;
+	} else if(positive() != (other >= 0))
 		return __add_eq_signless(__constexpr_abs(other)); // Specialisation
-	} else {
-		if(is_zero()) {
-			*this = other;
-			negative = positive();
-			return *this;
-		}
+	else
 		return __sub_eq_signless(__constexpr_abs(other)); // Specialisation
-	}
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator*=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator*=(const std::int64_t other)
 {
 	if(is_zero() || other == 1)
 		return *this;
@@ -220,8 +202,8 @@ constexpr BigInt<base>& BigInt<base>::operator*=(const std::int64_t other)
 	return __mul_eq_signless(__constexpr_abs(other)); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator/=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator/=(const std::int64_t other)
 {
 	if(other == 0)
 		throw std::domain_error(__THROW_DIVIDE_ZERO_DOMAIN);
@@ -239,8 +221,8 @@ constexpr BigInt<base>& BigInt<base>::operator/=(const std::int64_t other)
 	return __div_mod_eq_signless<false>(other_abs); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator%=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator%=(const std::int64_t other)
 {
 	if(other == 0)
 		throw std::domain_error(__THROW_DIVIDE_ZERO_DOMAIN);
@@ -253,8 +235,8 @@ constexpr BigInt<base>& BigInt<base>::operator%=(const std::int64_t other)
 	return __div_mod_eq_signless<true>(other_abs); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator&=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator&=(const std::int64_t other)
 {
 	const auto neg = !positive() || (other < 0);
 	if(is_zero()) {
@@ -270,8 +252,8 @@ constexpr BigInt<base>& BigInt<base>::operator&=(const std::int64_t other)
 	return __bitwise_signless<BitwiseType::AND>(__constexpr_abs(other)); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator|=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator|=(const std::int64_t other)
 {
 	const auto neg = !positive() && (other < 0);
 	if(other == 0) {
@@ -287,8 +269,8 @@ constexpr BigInt<base>& BigInt<base>::operator|=(const std::int64_t other)
 	return __bitwise_signless<BitwiseType::OR>(__constexpr_abs(other)); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator^=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator^=(const std::int64_t other)
 {
 	const auto neg = positive() == (other >= 0);
 	if(other == 0) {
@@ -304,116 +286,116 @@ constexpr BigInt<base>& BigInt<base>::operator^=(const std::int64_t other)
 	return __bitwise_signless<BitwiseType::XOR>(__constexpr_abs(other)); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator<<=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator<<=(const std::int64_t other)
 {
 	return __shl_shr_eq_helper<false>(other); // Specialisation
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator>>=(const std::int64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator>>=(const std::int64_t other)
 {
 	return __shl_shr_eq_helper<true>(other); // Specialisation
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator+=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator+=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this += static_cast<std::int64_t>(other);
 	else
-		return *this += make_big_int<base>(other);
+		return *this += make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator-=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator-=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this -= static_cast<std::int64_t>(other);
 	else
-		return *this -= make_big_int<base>(other);
+		return *this -= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator*=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator*=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this *= static_cast<std::int64_t>(other);
 	else
-		return *this *= make_big_int<base>(other);
+		return *this *= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator/=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator/=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this /= static_cast<std::int64_t>(other);
 	else
-		return *this /= make_big_int<base>(other);
+		return *this /= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator%=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator%=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this %= static_cast<std::int64_t>(other);
 	else
-		return *this %= make_big_int<base>(other);
+		return *this %= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator&=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator&=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this &= static_cast<std::int64_t>(other);
 	else
-		return *this &= make_big_int<base>(other);
+		return *this &= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator|=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator|=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this |= static_cast<std::int64_t>(other);
 	else
-		return *this |= make_big_int<base>(other);
+		return *this |= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator^=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator^=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this ^= static_cast<std::int64_t>(other);
 	else
-		return *this ^= make_big_int<base>(other);
+		return *this ^= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator<<=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator<<=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this <<= static_cast<std::int64_t>(other);
 	else
-		return *this <<= make_big_int<base>(other);
+		return *this <<= make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::operator>>=(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator>>=(const T other)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this >>= static_cast<std::int64_t>(other);
 	else
-		return *this >>= make_big_int<base>(other);
+		return *this >>= make_big_int<base, Allocator>(other, get_allocator());
 }
 
 #endif // BIG_INT_ARITHMETIC_ASSIGNMENT_OPERATORS_HPP
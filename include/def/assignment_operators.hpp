@@ -7,24 +7,37 @@
 #include "constructors.hpp"
 #include "external_functions.hpp"
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::operator=(const BigIntConstructible auto other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator=(const BigIntConstructible auto other)
 {
-	return *this = make_big_int<base>(other);
+	return *this = make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<std::uint32_t other_base>
-constexpr BigInt<base>& BigInt<base>::operator=(const BigInt<other_base>& other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator=(const BigInt<other_base, Allocator>& other)
 {
-	return *this = BigInt<base>(other);
+	return *this = BigInt<base, Allocator>(other);
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<std::uint32_t other_base>
-constexpr BigInt<base>& BigInt<base>::operator=(BigInt<other_base>&& other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator=(BigInt<other_base, Allocator>&& other)
 {
-	return *this = BigInt<base>(std::move(other));
+	return *this = BigInt<base, Allocator>(std::move(other));
+}
+
+template<std::uint32_t base, typename Allocator>
+template<LazyBigIntExpression Expr> requires std::same_as<typename Expr::big_int_type, BigInt<base, Allocator>>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::operator=(const Expr& expr)
+{
+	if(expr.refers_to(*this)) { // e.g. a = lazy(a) * b + c: a is read throughout
+		BigInt temp(get_allocator());
+		expr.eval_to(temp);
+		swap(temp);
+	} else
+		expr.eval_to(*this);
+	return *this;
 }
 
 #endif // BIG_INT_ASSIGNMENT_OPERATORS_HPP
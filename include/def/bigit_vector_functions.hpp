@@ -0,0 +1,360 @@
+#ifndef BIG_INT_BIGIT_VECTOR_FUNCTIONS_HPP
+#define BIG_INT_BIGIT_VECTOR_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <memory>
+
+#include "../big_int.hpp"
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(const Allocator& _alloc) noexcept
+  : alloc(_alloc)
+{}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(const BigitVector& other)
+  : BigitVector(other, __alloc_traits::select_on_container_copy_construction(other.alloc))
+{}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(const BigitVector& other, const Allocator& _alloc)
+  : alloc(_alloc)
+{
+	assign(other.begin(), other.end());
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(BigitVector&& other) noexcept
+  : alloc(other.alloc)
+{
+	__steal(other);
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(BigitVector&& other, const Allocator& _alloc)
+  : alloc(_alloc)
+{ // Heap bigits can only be taken over from an equal allocator, otherwise they are copied
+	if(alloc == other.alloc)
+		__steal(other);
+	else
+		assign(other.begin(), other.end());
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(const std::size_t n, const std::uint32_t value, const Allocator& _alloc)
+  : alloc(_alloc)
+{
+	assign(n, value);
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::BigitVector(std::span<const std::uint32_t> other, const Allocator& _alloc)
+  : BigitVector(other.begin(), other.end(), _alloc)
+{}
+
+template<typename Allocator>
+template<std::forward_iterator It>
+constexpr BigitVector<Allocator>::BigitVector(It first, It last, const Allocator& _alloc)
+  : alloc(_alloc)
+{
+	assign(first, last);
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>::~BigitVector()
+{
+	__release();
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>& BigitVector<Allocator>::operator=(const BigitVector& other)
+{
+	if(this == &other)
+		return *this;
+	if constexpr(__alloc_traits::propagate_on_container_copy_assignment::value) {
+		if(alloc != other.alloc)
+			__release(); // Any heap bigits belong to the old allocator
+		alloc = other.alloc;
+	}
+	assign(other.begin(), other.end());
+	return *this;
+}
+
+template<typename Allocator>
+constexpr BigitVector<Allocator>& BigitVector<Allocator>::operator=(BigitVector&& other) noexcept(
+  __alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value)
+{ // Heap bigits are taken over if the allocator propagates or is equal, leaving other empty. Otherwise they are copied
+	if(this == &other)
+		return *this;
+	if constexpr(__alloc_traits::propagate_on_container_move_assignment::value) {
+		__release();
+		alloc = other.alloc;
+		__steal(other);
+	} else if(alloc == other.alloc) {
+		__release();
+		__steal(other);
+	} else
+		assign(other.begin(), other.end());
+	return *this;
+}
+
+template<typename Allocator>
+constexpr bool BigitVector<Allocator>::operator==(const BigitVector& other) const noexcept
+{
+	return std::ranges::equal(*this, other);
+}
+
+template<typename Allocator>
+constexpr std::uint32_t& BigitVector<Allocator>::operator[](const std::size_t idx) noexcept
+{
+	assert(idx < count);
+	return data()[idx];
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t& BigitVector<Allocator>::operator[](const std::size_t idx) const noexcept
+{
+	assert(idx < count);
+	return data()[idx];
+}
+
+template<typename Allocator>
+constexpr std::uint32_t& BigitVector<Allocator>::front() noexcept
+{
+	return (*this)[0];
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t& BigitVector<Allocator>::front() const noexcept
+{
+	return (*this)[0];
+}
+
+template<typename Allocator>
+constexpr std::uint32_t& BigitVector<Allocator>::back() noexcept
+{
+	return (*this)[count - 1];
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t& BigitVector<Allocator>::back() const noexcept
+{
+	return (*this)[count - 1];
+}
+
+template<typename Allocator>
+constexpr std::uint32_t* BigitVector<Allocator>::data() noexcept
+{
+	return heap ? std::to_address(heap) : inline_bigits.data();
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t* BigitVector<Allocator>::data() const noexcept
+{
+	return heap ? std::to_address(heap) : inline_bigits.data();
+}
+
+template<typename Allocator>
+constexpr std::uint32_t* BigitVector<Allocator>::begin() noexcept
+{
+	return data();
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t* BigitVector<Allocator>::begin() const noexcept
+{
+	return data();
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t* BigitVector<Allocator>::cbegin() const noexcept
+{
+	return data();
+}
+
+template<typename Allocator>
+constexpr std::uint32_t* BigitVector<Allocator>::end() noexcept
+{
+	return data() + count;
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t* BigitVector<Allocator>::end() const noexcept
+{
+	return data() + count;
+}
+
+template<typename Allocator>
+constexpr const std::uint32_t* BigitVector<Allocator>::cend() const noexcept
+{
+	return data() + count;
+}
+
+template<typename Allocator>
+constexpr bool BigitVector<Allocator>::empty() const noexcept
+{
+	return count == 0;
+}
+
+template<typename Allocator>
+constexpr std::size_t BigitVector<Allocator>::size() const noexcept
+{
+	return count;
+}
+
+template<typename Allocator>
+constexpr std::size_t BigitVector<Allocator>::capacity() const noexcept
+{
+	return cap;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::reserve(const std::size_t new_cap)
+{
+	if(new_cap > cap)
+		__reallocate(new_cap);
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::clear() noexcept
+{
+	count = 0;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::resize(const std::size_t n, const std::uint32_t value)
+{
+	if(n > cap)
+		__reallocate(std::max(n, 2 * cap));
+	for(auto idx = data() + count; idx < data() + n; ++idx)
+		__alloc_traits::construct(alloc, idx, value);
+	count = n;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::assign(const std::size_t n, const std::uint32_t value)
+{
+	clear();
+	resize(n, value);
+}
+
+template<typename Allocator>
+template<std::forward_iterator It>
+constexpr void BigitVector<Allocator>::assign(It first, It last)
+{ // [first, last) mustn't be in *this
+	const auto n = static_cast<std::size_t>(std::ranges::distance(first, last));
+	clear();
+	reserve(n);
+	for(auto idx = data(); first != last; ++first, ++idx)
+		__alloc_traits::construct(alloc, idx, static_cast<std::uint32_t>(*first));
+	count = n;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::push_back(const std::uint32_t value)
+{
+	if(count == cap)
+		__reallocate(2 * cap);
+	__alloc_traits::construct(alloc, data() + count++, value);
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::pop_back() noexcept
+{
+	assert(count);
+	--count;
+}
+
+template<typename Allocator>
+constexpr std::uint32_t* BigitVector<Allocator>::insert(const std::uint32_t* pos, const std::size_t n, const std::uint32_t value)
+{ // Moves the bigits from pos up by n, then fills the gap: O(N)
+	const auto idx = static_cast<std::size_t>(pos - data());
+	const auto old_count = count;
+	resize(count + n);
+	const auto gap = data() + idx;
+	std::copy_backward(gap, data() + old_count, data() + count);
+	std::fill_n(gap, n, value);
+	return gap;
+}
+
+template<typename Allocator>
+template<std::forward_iterator It>
+constexpr std::uint32_t* BigitVector<Allocator>::insert(const std::uint32_t* pos, It first, It last)
+{ // As above, copying [first, last), which mustn't be in *this, into the gap
+	const auto idx = static_cast<std::size_t>(pos - data());
+	const auto n = static_cast<std::size_t>(std::ranges::distance(first, last));
+	const auto old_count = count;
+	resize(count + n);
+	const auto gap = data() + idx;
+	std::copy_backward(gap, data() + old_count, data() + count);
+	std::copy(first, last, gap);
+	return gap;
+}
+
+template<typename Allocator>
+constexpr std::uint32_t* BigitVector<Allocator>::erase(const std::uint32_t* first, const std::uint32_t* last) noexcept
+{
+	const auto gap = data() + (first - data());
+	std::copy(last, static_cast<const std::uint32_t*>(end()), gap);
+	count -= static_cast<std::size_t>(last - first);
+	return gap;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::swap(BigitVector& other) noexcept
+{ // Swaps the heap pointers and the inline bigits: O(1). As for std::vector, unless the allocator propagates on swap, both must be equal
+	if constexpr(__alloc_traits::propagate_on_container_swap::value)
+		std::ranges::swap(alloc, other.alloc);
+	else
+		assert(alloc == other.alloc);
+	std::ranges::swap(heap, other.heap);
+	std::ranges::swap(count, other.count);
+	std::ranges::swap(cap, other.cap);
+	std::ranges::swap(inline_bigits, other.inline_bigits);
+}
+
+template<typename Allocator>
+constexpr Allocator BigitVector<Allocator>::get_allocator() const noexcept
+{
+	return alloc;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::__steal(BigitVector& other) noexcept
+{ // Takes other's bigits into empty, inline *this, whose allocator can free them, leaving other empty
+	assert(!heap && alloc == other.alloc);
+	if(other.heap) {
+		heap = std::exchange(other.heap, nullptr);
+		cap = std::exchange(other.cap, BIG_INT_INLINE_BIGITS);
+	} else
+		std::ranges::copy(other.inline_bigits.begin(), other.inline_bigits.begin() + other.count, inline_bigits.begin());
+	count = std::exchange(other.count, 0);
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::__reallocate(const std::size_t new_cap)
+{ // Moves the bigits to a new heap block of new_cap bigits
+	assert(new_cap >= count);
+	const auto new_heap = __alloc_traits::allocate(alloc, new_cap);
+	for(std::size_t idx = 0; idx != count; ++idx)
+		__alloc_traits::construct(alloc, std::to_address(new_heap) + idx, data()[idx]);
+	const auto old_count = count;
+	__release();
+	heap = new_heap;
+	cap = new_cap;
+	count = old_count;
+}
+
+template<typename Allocator>
+constexpr void BigitVector<Allocator>::__release() noexcept
+{ // Frees any heap block, leaving *this empty and inline
+	if(heap)
+		__alloc_traits::deallocate(alloc, heap, cap);
+	heap = nullptr;
+	cap = BIG_INT_INLINE_BIGITS;
+	count = 0;
+}
+
+#endif // BIG_INT_BIGIT_VECTOR_FUNCTIONS_HPP
@@ -4,126 +4,330 @@
 #include "../big_int.hpp"
 #include "arithmetic_assignment_operators.hpp"
 #include "member_functions.hpp"
+#include "unary_operators.hpp"
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator+(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator+(const BigInt<base, Allocator>& other) const&
 {
-	return clone() += other;
+	return std::move(clone() += other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator-(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator+(const BigInt<base, Allocator>& other) &&
 {
-	return clone() -= other;
+	return std::move(*this += other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator*(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator+(BigInt<base, Allocator>&& other) const&
+{ // Addition commutes: the result is built in other, which must have *this's allocator to hold it
+	if(get_allocator() != other.get_allocator())
+		return *this + other;
+	return std::move(other += *this);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator+(BigInt<base, Allocator>&& other) &&
 {
-	return clone() *= other;
+	return std::move(*this += other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator/(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator-(const BigInt<base, Allocator>& other) const&
 {
-	return clone() /= other;
+	return std::move(clone() -= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator%(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator-(const BigInt<base, Allocator>& other) &&
 {
-	return clone() %= other;
+	return std::move(*this -= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator-(BigInt<base, Allocator>&& other) const&
+{ // a - b is -(b - a): the difference is built in other, which must have *this's allocator to hold the result
+	if(get_allocator() != other.get_allocator())
+		return *this - other;
+	return -std::move(other -= *this);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator&(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator-(BigInt<base, Allocator>&& other) &&
 {
-	return clone() &= other;
+	return std::move(*this -= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator|(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator*(const BigInt<base, Allocator>& other) const&
 {
-	return clone() |= other;
+	return std::move(clone() *= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator^(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator*(const BigInt<base, Allocator>& other) &&
 {
-	return clone() ^= other;
+	return std::move(*this *= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator*(BigInt<base, Allocator>&& other) const&
+{ // Multiplication commutes: the result is built in other, which must have *this's allocator to hold it
+	if(get_allocator() != other.get_allocator())
+		return *this * other;
+	return std::move(other *= *this);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator<<(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator*(BigInt<base, Allocator>&& other) &&
 {
-	return clone() <<= other;
+	return std::move(*this *= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator>>(const BigInt<base>& other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator/(const BigInt<base, Allocator>& other) const&
 {
-	return clone() >>= other;
+	return std::move(clone() /= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator+(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator/(const BigInt<base, Allocator>& other) &&
 {
-	return clone() += other;
+	return std::move(*this /= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator-(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator%(const BigInt<base, Allocator>& other) const&
 {
-	return clone() -= other;
+	return std::move(clone() %= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator*(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator%(const BigInt<base, Allocator>& other) &&
 {
-	return clone() *= other;
+	return std::move(*this %= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator/(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator&(const BigInt<base, Allocator>& other) const&
 {
-	return clone() /= other;
+	return std::move(clone() &= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator%(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator&(const BigInt<base, Allocator>& other) &&
 {
-	return clone() %= other;
+	return std::move(*this &= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator&(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator&(BigInt<base, Allocator>&& other) const&
+{ // Bitwise AND commutes: the result is built in other, which must have *this's allocator to hold it
+	if(get_allocator() != other.get_allocator())
+		return *this & other;
+	return std::move(other &= *this);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator&(BigInt<base, Allocator>&& other) &&
 {
-	return clone() &= other;
+	return std::move(*this &= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator|(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator|(const BigInt<base, Allocator>& other) const&
 {
-	return clone() |= other;
+	return std::move(clone() |= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator^(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator|(const BigInt<base, Allocator>& other) &&
 {
-	return clone() ^= other;
+	return std::move(*this |= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator|(BigInt<base, Allocator>&& other) const&
+{ // Bitwise OR commutes: the result is built in other, which must have *this's allocator to hold it
+	if(get_allocator() != other.get_allocator())
+		return *this | other;
+	return std::move(other |= *this);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator<<(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator|(BigInt<base, Allocator>&& other) &&
 {
-	return clone() <<= other;
+	return std::move(*this |= other);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::operator>>(const BigIntConstructible auto other) const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator^(const BigInt<base, Allocator>& other) const&
 {
-	return clone() >>= other;
+	return std::move(clone() ^= other);
 }
 
-#endif // BIG_INT_BINARY_ARITHMETIC_OPERATORS_HPP
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator^(const BigInt<base, Allocator>& other) &&
+{
+	return std::move(*this ^= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator^(BigInt<base, Allocator>&& other) const&
+{ // Bitwise XOR commutes: the result is built in other, which must have *this's allocator to hold it
+	if(get_allocator() != other.get_allocator())
+		return *this ^ other;
+	return std::move(other ^= *this);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator^(BigInt<base, Allocator>&& other) &&
+{
+	return std::move(*this ^= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator<<(const BigInt<base, Allocator>& other) const&
+{
+	return std::move(clone() <<= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator<<(const BigInt<base, Allocator>& other) &&
+{
+	return std::move(*this <<= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator>>(const BigInt<base, Allocator>& other) const&
+{
+	return std::move(clone() >>= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator>>(const BigInt<base, Allocator>& other) &&
+{
+	return std::move(*this >>= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator+(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() += other);
+}
 
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator+(const BigIntConstructible auto other) &&
+{
+	return std::move(*this += other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator-(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() -= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator-(const BigIntConstructible auto other) &&
+{
+	return std::move(*this -= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator*(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() *= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator*(const BigIntConstructible auto other) &&
+{
+	return std::move(*this *= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator/(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() /= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator/(const BigIntConstructible auto other) &&
+{
+	return std::move(*this /= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator%(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() %= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator%(const BigIntConstructible auto other) &&
+{
+	return std::move(*this %= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator&(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() &= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator&(const BigIntConstructible auto other) &&
+{
+	return std::move(*this &= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator|(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() |= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator|(const BigIntConstructible auto other) &&
+{
+	return std::move(*this |= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator^(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() ^= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator^(const BigIntConstructible auto other) &&
+{
+	return std::move(*this ^= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator<<(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() <<= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator<<(const BigIntConstructible auto other) &&
+{
+	return std::move(*this <<= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator>>(const BigIntConstructible auto other) const&
+{
+	return std::move(clone() >>= other);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::operator>>(const BigIntConstructible auto other) &&
+{
+	return std::move(*this >>= other);
+}
+
+#endif // BIG_INT_BINARY_ARITHMETIC_OPERATORS_HPP
@@ -7,8 +7,8 @@
 #include "helper_functions.hpp"
 #include "external_functions.hpp"
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::operator==(const BigInt<base>& other) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::operator==(const BigInt<base, Allocator>& other) const noexcept
 {
 	if(positive() != other.positive())
 		return is_zero() && other.is_zero();
@@ -17,14 +17,14 @@ constexpr bool BigInt<base>::operator==(const BigInt<base>& other) const noexcep
 	return true;
 }
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::operator!=(const BigInt<base>& other) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::operator!=(const BigInt<base, Allocator>& other) const noexcept
 {
 	return !(*this == other);
 }
 
-template<std::uint32_t base>
-constexpr std::strong_ordering BigInt<base>::operator<=>(const BigInt<base>& other) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::strong_ordering BigInt<base, Allocator>::operator<=>(const BigInt<base, Allocator>& other) const noexcept
 {
 	if(positive() != other.positive()) {
 		if(is_zero() && other.is_zero())
@@ -34,8 +34,8 @@ constexpr std::strong_ordering BigInt<base>::operator<=>(const BigInt<base>& oth
 	return __compare_signless(other, positive());
 }
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::operator==(std::int64_t other) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::operator==(std::int64_t other) const noexcept
 {
 	if(positive() != (other >= 0))
 		return is_zero() && other == 0;
@@ -50,8 +50,8 @@ constexpr bool BigInt<base>::operator==(std::int64_t other) const noexcept
 	return true;
 }
 
-template<std::uint32_t base>
-constexpr std::strong_ordering BigInt<base>::operator<=>(std::int64_t other) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::strong_ordering BigInt<base, Allocator>::operator<=>(std::int64_t other) const noexcept
 {
 	const auto other_positive = other >= 0;
 	if(positive() != other_positive) {
@@ -62,31 +62,31 @@ constexpr std::strong_ordering BigInt<base>::operator<=>(std::int64_t other) con
 	return __compare_signless(__constexpr_abs(other), positive()); // Specialisation
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr bool BigInt<base>::operator==(const T other) const noexcept(INT64Constructible<T>)
+constexpr bool BigInt<base, Allocator>::operator==(const T other) const noexcept(INT64Constructible<T>)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this == static_cast<std::int64_t>(other);
 	else
-		return *this == make_big_int<base>(other);
+		return *this == make_big_int<base, Allocator>(other, get_allocator());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr bool BigInt<base>::operator!=(const T other) const noexcept(INT64Constructible<T>)
+constexpr bool BigInt<base, Allocator>::operator!=(const T other) const noexcept(INT64Constructible<T>)
 {
 	return !(*this == other);
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr std::strong_ordering BigInt<base>::operator<=>(const T other) const noexcept(INT64Constructible<T>)
+constexpr std::strong_ordering BigInt<base, Allocator>::operator<=>(const T other) const noexcept(INT64Constructible<T>)
 {
 	if constexpr(INT64Constructible<T>)
 		return *this <=> static_cast<std::int64_t>(other);
 	else
-		return *this <=> make_big_int<base>(other);
+		return *this <=> make_big_int<base, Allocator>(other, get_allocator());
 }
 
 #endif // BIG_INT_COMPARISON_OPERATORS_HPP
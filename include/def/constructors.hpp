@@ -8,36 +8,47 @@
 #include <stdexcept>
 
 #include "../big_int.hpp"
+#include "bigit_vector_functions.hpp"
 #include "arithmetic_assignment_operators.hpp"
 #include "member_functions.hpp"
 #include "static_functions.hpp"
 #include "utility_functions.hpp"
 
-template<std::uint32_t base>
-constexpr BigInt<base>::BigInt()
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt()
   : bigits(1, 0)
   , negative(false)
 {}
 
-template<std::uint32_t base>
-constexpr BigInt<base>::BigInt(const std::vector<std::uint32_t>& _bigits, bool _negative)
-  : bigits(_bigits)
-  , negative(_negative)
-{
-	assert(valid());
-}
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt(const std::type_identity_t<Allocator>& alloc)
+  : bigits(1, 0, alloc)
+  , negative(false)
+{}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt(const BigInt<base, Allocator>& other, const std::type_identity_t<Allocator>& alloc)
+  : bigits(other.bigits, alloc)
+  , negative(other.negative)
+{}
 
-template<std::uint32_t base>
-constexpr BigInt<base>::BigInt(std::vector<std::uint32_t>&& _bigits, bool _negative)
-  : bigits(std::move(_bigits))
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt(BigInt<base, Allocator>&& other, const std::type_identity_t<Allocator>& alloc)
+  : bigits(std::move(other.bigits), alloc)
+  , negative(other.negative)
+{}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt(const std::vector<std::uint32_t>& _bigits, bool _negative, const std::type_identity_t<Allocator>& alloc)
+  : bigits(_bigits, alloc)
   , negative(_negative)
 {
 	assert(valid());
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>::BigInt(const std::int64_t num)
-  : bigits(__int_size(num), 0)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt(const std::int64_t num, const std::type_identity_t<Allocator>& alloc)
+  : bigits(__int_size(num), 0, alloc)
   , negative(num < 0)
 {
 	std::uint64_t num_copy = __constexpr_abs(num);
@@ -48,9 +59,9 @@ constexpr BigInt<base>::BigInt(const std::int64_t num)
 	assert(valid());
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>::BigInt(const std::string_view sv, const char sv_base)
-  : BigInt()
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>::BigInt(const std::string_view sv, const char sv_base, const std::type_identity_t<Allocator>& alloc)
+  : BigInt(alloc)
 {
 	if(sv_base < 2 || 36 < sv_base)
 		throw std::domain_error(__THROW_SV_BASE_DOMAIN);
@@ -70,51 +81,56 @@ constexpr BigInt<base>::BigInt(const std::string_view sv, const char sv_base)
 		resize(((sv_stripped.size() - 1) / chars_per_bigit) + 1, 0);
 		std::size_t idx = sv_stripped.size();
 
-		for(bool on_last; auto& bigit : bigits) {
-			on_last = idx <= chars_per_bigit;
-			if(!on_last)
-				idx -= chars_per_bigit;
-			for(std::size_t i = on_last ? 0 : idx; i < (on_last ? idx : idx + chars_per_bigit); ++i) {
-				bigit *= sv_base;
-				bigit += __char_value(sv_stripped[i], sv_base);
-			}
+		for(auto& bigit : bigits) {
+			const auto bigit_start = idx > chars_per_bigit ? idx - chars_per_bigit : 0;
+			bigit = __chars_value(sv_stripped.substr(bigit_start, idx - bigit_start), sv_base);
+			idx = bigit_start;
 		}
 	} else {
-		*this += __char_value(sv_stripped.front(), sv_base);
-		for(const auto c : sv_stripped | __DROP1_V) {
-			*this *= sv_base;
-			*this += __char_value(c, sv_base);
+		// Read the chars in chunks, each the largest power of sv_base that fits in a bigit, then convert the chunks by divide and conquer
+		std::uint8_t chars_per_chunk;
+		const auto chunk_base = __max_pow_in_bigit(sv_base, chars_per_chunk);
+		std::vector<std::uint32_t, Allocator> chunks((sv_stripped.size() - 1) / chars_per_chunk + 1, 0, get_allocator());
+		std::size_t idx = sv_stripped.size();
+		for(auto& chunk : chunks) { // From the least significant chunk, so that only the most significant one is short
+			const auto chunk_start = idx > chars_per_chunk ? idx - chars_per_chunk : 0;
+			chunk = __chars_value(sv_stripped.substr(chunk_start, idx - chunk_start), sv_base);
+			idx = chunk_start;
 		}
+		*this = __from_radix(chunks, chunk_base, get_allocator());
 	}
 	negative = sv.front() == '-';
 	assert(valid());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<std::uint32_t other_base>
-constexpr BigInt<base>::BigInt(const BigInt<other_base>& other)
-  : BigInt(other.back())
-{
-	for(const auto bigit : other.bigits | __REV_DROP1_V) {
-		*this *= other.true_base();
-		*this += bigit;
-	}
+constexpr BigInt<base, Allocator>::BigInt(const BigInt<other_base, Allocator>& other)
+  : BigInt(other.get_allocator())
+{ // The bigits go to other's allocator
+	*this = __from_base<other_base>(other.bigits, get_allocator());
 	negative = other.negative;
 	assert(valid());
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<std::uint32_t other_base>
-constexpr BigInt<base>::BigInt(BigInt<other_base>&& other)
-  : BigInt(other.back())
+constexpr BigInt<base, Allocator>::BigInt(BigInt<other_base, Allocator>&& other)
+  : BigInt(other.get_allocator())
 {
-	for(const auto bigit : std::move(other.bigits) | __REV_DROP1_V) {
-		*this *= other.true_base();
-		*this += bigit;
-	}
+	*this = __from_base<other_base>(other.bigits, get_allocator());
 	negative = std::move(other.negative);
 	assert(valid());
 }
 
+template<std::uint32_t base, typename Allocator>
+template<LazyBigIntExpression Expr> requires std::same_as<typename Expr::big_int_type, BigInt<base, Allocator>>
+constexpr BigInt<base, Allocator>::BigInt(const Expr& expr, const std::type_identity_t<Allocator>& alloc)
+  : BigInt(alloc)
+{ // Can't be one of the operands
+	expr.eval_to(*this);
+	assert(valid());
+}
+
 #endif // BIG_INT_CONSTRUCTORS_HPP
 
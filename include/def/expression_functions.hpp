@@ -0,0 +1,241 @@
+#ifndef BIG_INT_EXPRESSION_FUNCTIONS_HPP
+#define BIG_INT_EXPRESSION_FUNCTIONS_HPP
+
+#include <cstdint>
+#include <cassert>
+#include <type_traits>
+
+#include "../big_int.hpp"
+#include "assignment_operators.hpp"
+#include "arithmetic_assignment_operators.hpp"
+#include "constructors.hpp"
+#include "helper_functions.hpp"
+#include "member_functions.hpp"
+
+template<std::uint32_t base, typename Allocator>
+constexpr LazyBigInt<base, Allocator>::LazyBigInt(const BigInt<base, Allocator>& bi) noexcept
+  : value(bi)
+{}
+
+template<std::uint32_t base, typename Allocator>
+constexpr const BigInt<base, Allocator>& LazyBigInt<base, Allocator>::get() const noexcept
+{
+	return value;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr bool LazyBigInt<base, Allocator>::refers_to(const BigInt<base, Allocator>& bi) const noexcept
+{
+	return &value == &bi;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void LazyBigInt<base, Allocator>::eval_to(BigInt<base, Allocator>& dest) const
+{
+	dest = value;
+}
+
+template<ExpressionType type, typename Lhs, typename Rhs>
+constexpr BigIntExpression<type, Lhs, Rhs>::BigIntExpression(const Lhs& _lhs, const Rhs& _rhs)
+  : lhs(_lhs)
+  , rhs(_rhs)
+{}
+
+template<ExpressionType type, typename Lhs, typename Rhs>
+constexpr bool BigIntExpression<type, Lhs, Rhs>::refers_to(const big_int_type& bi) const noexcept
+{
+	if constexpr(std::is_same_v<Rhs, std::int64_t>)
+		return lhs.refers_to(bi);
+	else
+		return lhs.refers_to(bi) || rhs.refers_to(bi);
+}
+
+template<ExpressionType type, typename Lhs, typename Rhs>
+constexpr void BigIntExpression<type, Lhs, Rhs>::eval_to(big_int_type& dest) const
+{ // Each operator works in place in dest. Only when both operands are themselves operations is a temporary needed, for rhs
+	constexpr auto additive = type == ExpressionType::ADD || type == ExpressionType::SUB;
+	if constexpr(__PRODUCT) // Built straight into dest's bigits
+		dest.__mul_of(lhs.get(), rhs.get());
+	else if constexpr(additive && __IS_PRODUCT<Rhs>) { // addmul, submul: the product is accumulated into lhs
+		lhs.eval_to(dest);
+		dest.__addmul_eq(rhs.lhs.get(), rhs.rhs.get(), type == ExpressionType::SUB);
+	} else if constexpr(additive && __IS_PRODUCT<Lhs>) { // a * b + c is c + a * b, and a * b - c is -(c - a * b)
+		__eval_operand(rhs, dest);
+		dest.__addmul_eq(lhs.lhs.get(), lhs.rhs.get(), type == ExpressionType::SUB);
+		if constexpr(type == ExpressionType::SUB)
+			dest.negative = !dest.negative;
+	} else if constexpr(type == ExpressionType::MOD && __IS_PRODUCT<Lhs> && std::is_same_v<Rhs, std::int64_t>) // mulmod
+		dest.__mulmod_of(lhs.lhs.get(), lhs.rhs.get(), rhs);
+	else if constexpr((additive || type == ExpressionType::MUL) && __IS_LEAF<Lhs> && !__IS_LEAF<Rhs> && !std::is_same_v<Rhs, std::int64_t>) {
+		rhs.eval_to(dest); // Only rhs is an operation: evaluate it first, then bring in lhs, as a + b is b + a, and a - b is -(b - a)
+		__apply(dest, lhs.get());
+		if constexpr(type == ExpressionType::SUB)
+			dest.negative = !dest.negative;
+	} else {
+		lhs.eval_to(dest);
+		if constexpr(std::is_same_v<Rhs, std::int64_t>)
+			__apply(dest, rhs);
+		else if constexpr(__IS_LEAF<Rhs>)
+			__apply(dest, rhs.get());
+		else {
+			big_int_type rhs_value(dest.get_allocator());
+			rhs.eval_to(rhs_value);
+			__apply(dest, rhs_value);
+		}
+	}
+	assert(dest.valid());
+}
+
+template<ExpressionType type, typename Lhs, typename Rhs>
+template<typename T>
+constexpr void BigIntExpression<type, Lhs, Rhs>::__eval_operand(const T& operand, big_int_type& dest)
+{
+	if constexpr(std::is_same_v<T, std::int64_t>)
+		dest = operand;
+	else
+		operand.eval_to(dest);
+}
+
+template<ExpressionType type, typename Lhs, typename Rhs>
+template<typename T>
+constexpr void BigIntExpression<type, Lhs, Rhs>::__apply(big_int_type& dest, const T& operand)
+{ // dest op= operand
+	if constexpr(type == ExpressionType::ADD)
+		dest += operand;
+	else if constexpr(type == ExpressionType::SUB)
+		dest -= operand;
+	else if constexpr(type == ExpressionType::MUL)
+		dest *= operand;
+	else if constexpr(type == ExpressionType::DIV)
+		dest /= operand;
+	else
+		dest %= operand;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr LazyBigInt<base, Allocator> lazy(const BigInt<base, Allocator>& bi) noexcept
+{
+	return LazyBigInt<base, Allocator>(bi);
+}
+
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::ADD, Lhs, Rhs> operator+(const Lhs& lhs, const Rhs& rhs)
+{
+	return BigIntExpression<ExpressionType::ADD, Lhs, Rhs>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::ADD, Lhs, LazyBigInt<base, Allocator>> operator+(const Lhs& lhs, const BigInt<base, Allocator>& rhs)
+{
+	return lhs + lazy(rhs);
+}
+
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::ADD, LazyBigInt<base, Allocator>, Rhs> operator+(const BigInt<base, Allocator>& lhs, const Rhs& rhs)
+{
+	return lazy(lhs) + rhs;
+}
+
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::ADD, Lhs, std::int64_t> operator+(const Lhs& lhs, const std::int64_t rhs)
+{
+	return BigIntExpression<ExpressionType::ADD, Lhs, std::int64_t>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::SUB, Lhs, Rhs> operator-(const Lhs& lhs, const Rhs& rhs)
+{
+	return BigIntExpression<ExpressionType::SUB, Lhs, Rhs>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::SUB, Lhs, LazyBigInt<base, Allocator>> operator-(const Lhs& lhs, const BigInt<base, Allocator>& rhs)
+{
+	return lhs - lazy(rhs);
+}
+
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::SUB, LazyBigInt<base, Allocator>, Rhs> operator-(const BigInt<base, Allocator>& lhs, const Rhs& rhs)
+{
+	return lazy(lhs) - rhs;
+}
+
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::SUB, Lhs, std::int64_t> operator-(const Lhs& lhs, const std::int64_t rhs)
+{
+	return BigIntExpression<ExpressionType::SUB, Lhs, std::int64_t>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::MUL, Lhs, Rhs> operator*(const Lhs& lhs, const Rhs& rhs)
+{
+	return BigIntExpression<ExpressionType::MUL, Lhs, Rhs>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MUL, Lhs, LazyBigInt<base, Allocator>> operator*(const Lhs& lhs, const BigInt<base, Allocator>& rhs)
+{
+	return lhs * lazy(rhs);
+}
+
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MUL, LazyBigInt<base, Allocator>, Rhs> operator*(const BigInt<base, Allocator>& lhs, const Rhs& rhs)
+{
+	return lazy(lhs) * rhs;
+}
+
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::MUL, Lhs, std::int64_t> operator*(const Lhs& lhs, const std::int64_t rhs)
+{
+	return BigIntExpression<ExpressionType::MUL, Lhs, std::int64_t>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::DIV, Lhs, Rhs> operator/(const Lhs& lhs, const Rhs& rhs)
+{
+	return BigIntExpression<ExpressionType::DIV, Lhs, Rhs>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::DIV, Lhs, LazyBigInt<base, Allocator>> operator/(const Lhs& lhs, const BigInt<base, Allocator>& rhs)
+{
+	return lhs / lazy(rhs);
+}
+
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::DIV, LazyBigInt<base, Allocator>, Rhs> operator/(const BigInt<base, Allocator>& lhs, const Rhs& rhs)
+{
+	return lazy(lhs) / rhs;
+}
+
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::DIV, Lhs, std::int64_t> operator/(const Lhs& lhs, const std::int64_t rhs)
+{
+	return BigIntExpression<ExpressionType::DIV, Lhs, std::int64_t>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, LazyBigIntExpression Rhs> requires std::same_as<typename Lhs::big_int_type, typename Rhs::big_int_type>
+constexpr BigIntExpression<ExpressionType::MOD, Lhs, Rhs> operator%(const Lhs& lhs, const Rhs& rhs)
+{
+	return BigIntExpression<ExpressionType::MOD, Lhs, Rhs>(lhs, rhs);
+}
+
+template<LazyBigIntExpression Lhs, std::uint32_t base, typename Allocator> requires std::same_as<typename Lhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MOD, Lhs, LazyBigInt<base, Allocator>> operator%(const Lhs& lhs, const BigInt<base, Allocator>& rhs)
+{
+	return lhs % lazy(rhs);
+}
+
+template<std::uint32_t base, typename Allocator, LazyBigIntExpression Rhs> requires std::same_as<typename Rhs::big_int_type, BigInt<base, Allocator>>
+constexpr BigIntExpression<ExpressionType::MOD, LazyBigInt<base, Allocator>, Rhs> operator%(const BigInt<base, Allocator>& lhs, const Rhs& rhs)
+{
+	return lazy(lhs) % rhs;
+}
+
+template<LazyBigIntExpression Lhs>
+constexpr BigIntExpression<ExpressionType::MOD, Lhs, std::int64_t> operator%(const Lhs& lhs, const std::int64_t rhs)
+{
+	return BigIntExpression<ExpressionType::MOD, Lhs, std::int64_t>(lhs, rhs);
+}
+
+#endif // BIG_INT_EXPRESSION_FUNCTIONS_HPP
@@ -5,10 +5,33 @@
 #include "constructors.hpp"
 #include "member_functions.hpp"
 
-template<std::uint32_t base>
-constexpr BigInt<base> make_big_int(const BigIntConstructible auto arg)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> make_big_int(const BigIntConstructible auto arg, const Allocator& alloc)
 {
-	return BigInt<base>(arg);
+	if constexpr(INT64Constructible<decltype(arg)>)
+		return BigInt<base, Allocator>(static_cast<std::int64_t>(arg), alloc);
+	else
+		return BigInt<base, Allocator>(std::string_view(arg), 10, alloc);
+}
+
+template<DivisionType type, std::uint32_t base, typename Allocator>
+constexpr std::pair<BigInt<base, Allocator>, BigInt<base, Allocator>> divmod(BigInt<base, Allocator> dividend, const BigInt<base, Allocator>& divisor)
+{
+	BigInt<base, Allocator> rem(dividend.get_allocator());
+	dividend.template div_rem<type>(divisor, rem);
+	return { std::move(dividend), std::move(rem) };
+}
+
+template<DivisionType type, std::uint32_t base, typename Allocator>
+constexpr std::pair<BigInt<base, Allocator>, BigInt<base, Allocator>> divmod(BigInt<base, Allocator> dividend, const BigIntConstructible auto divisor)
+{
+	return divmod<type>(std::move(dividend), make_big_int<base, Allocator>(divisor, dividend.get_allocator()));
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void swap(BigInt<base, Allocator>& lhs, BigInt<base, Allocator>& rhs) noexcept
+{
+	lhs.swap(rhs);
 }
 
 constexpr BigInt<> operator""_bi(std::uint64_t num)
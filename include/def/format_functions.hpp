@@ -0,0 +1,151 @@
+#ifndef BIG_INT_FORMAT_FUNCTIONS_HPP
+#define BIG_INT_FORMAT_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cctype>
+#include <locale>
+
+#include "../big_int.hpp"
+#include "member_functions.hpp"
+#include "helper_functions.hpp"
+#include "static_functions.hpp"
+
+// Format specs follow those of built-in integers: [[fill]align][sign][#][0][width][L|'][type]
+//   fill, align: any char but { or }, then < (left), > (right, the default) or ^ (centre)
+//   sign:        - (only negative values, the default), + (every value) or a space (a space for non-negative values)
+//   #:           prefix 0b, 0 or 0x for types b, o and x (0B and 0X for B and X)
+//   0:           pad with zeros after the sign and prefix, unless align is given
+//   L:           group digits as the locale does. ' groups them with ' every 3 digits, or every 4 for types b and x
+//   type:        b, B, o, d (the default), x or X
+// Dynamic width ({:{}}) and precision aren't supported
+
+template<std::uint32_t base, typename Allocator>
+template<std::output_iterator<char> It>
+It BigInt<base, Allocator>::format_to(It out, const std::string_view spec, const std::locale& loc) const
+{ // Digits go straight to out, a block at a time. They are only built first when they must be counted (for width or grouping) and B isn't
+  // a power of the radix; for a power, e.g. MAX_BASE in hexadecimal or binary, each bigit is dumped in turn
+	const auto fs = __parse_format_spec(spec);
+	const int radix = fs.type == 'b' || fs.type == 'B' ? 2 : fs.type == 'o' ? 8 : fs.type == 'x' || fs.type == 'X' ? 16 : 10;
+	const bool upper = fs.type == 'B' || fs.type == 'X';
+	if(true_base() < static_cast<std::uint64_t>(radix)) // Radix chars wouldn't fit in a bigit: format from MAX_BASE instead
+		return BigInt<MAX_BASE, Allocator>(*this).format_to(out, spec, loc);
+
+	std::string prefix = !positive() && !is_zero() ? "-" : fs.sign == '+' ? "+" : fs.sign == ' ' ? " " : "";
+	if(fs.alternate && radix != 10 && !(radix == 8 && is_zero()))
+		prefix += radix == 2 ? "0b" : radix == 8 ? "0" : "0x";
+	if(upper)
+		std::ranges::transform(prefix, prefix.begin(), [](const unsigned char c) { return static_cast<char>(std::toupper(c)); });
+	std::string grouping;
+	char separator = '\'';
+	if(fs.group == 'L') {
+		const auto& punct = std::use_facet<std::numpunct<char>>(loc);
+		grouping = punct.grouping();
+		separator = punct.thousands_sep();
+	} else if(fs.group == '\'')
+		grouping = radix == 2 || radix == 16 ? "\4" : "\3";
+
+	// The digits, counted when needed. Without grouping or padding they are never counted
+	std::string digits;
+	std::size_t digit_count = 0;
+	if(is_zero())
+		digit_count = 1;
+	else if(const auto chars_per_bigit = __int_log_of(true_base(), radix)) {
+		digit_count = (size() - 1) * chars_per_bigit;
+		for(auto top = back(); top; top /= radix)
+			++digit_count;
+	} else {
+		std::uint8_t chars_per_chunk; // The digits number at least (N - 1) * chars_per_chunk + 1
+		__max_pow_in_bigit(radix, chars_per_chunk);
+		if(!grouping.empty() || fs.width > prefix.size() + (size() - 1) * chars_per_chunk + 1) {
+			digits.resize(chars_needed(radix));
+			const auto [end, ec] = to_chars(digits.data(), digits.data() + digits.size(), radix);
+			assert(ec == std::errc{});
+			digits.erase(end - digits.data());
+			if(digits.front() == '-')
+				digits.erase(0, 1);
+			digit_count = digits.size();
+		}
+	}
+
+	// Separators go before the digit with remaining digits left, counting it, when remaining is a group boundary. Boundaries are the running
+	// sums of the group sizes, the last size repeating; a size of 0 or CHAR_MAX ends grouping
+	std::size_t last_boundary = 0, last_group = 0, separators = 0;
+	std::vector<std::size_t> boundaries; // Only those before the repeats, as few as grouping has chars
+	for(const auto group : grouping) {
+		if(group <= 0 || group == CHAR_MAX)
+			break;
+		last_group = static_cast<std::size_t>(group);
+		last_boundary += last_group;
+		boundaries.push_back(last_boundary);
+	}
+	if(!grouping.empty() && last_group && grouping.back() > 0 && grouping.back() != CHAR_MAX) // The last group repeats
+		boundaries.pop_back();
+	else
+		last_group = 0;
+	last_boundary = boundaries.empty() ? 0 : boundaries.back();
+	const auto is_boundary = [&](const std::size_t remaining) {
+		return std::ranges::find(boundaries, remaining) != boundaries.end() ||
+		       (last_group && remaining > last_boundary && (remaining - last_boundary) % last_group == 0);
+	};
+	if(digit_count) {
+		separators = static_cast<std::size_t>(std::ranges::count_if(boundaries, [digit_count](const auto boundary) { return boundary < digit_count; }));
+		if(last_group && digit_count > last_boundary + 1)
+			separators += (digit_count - last_boundary - 1) / last_group;
+	}
+
+	const auto length = prefix.size() + digit_count + separators;
+	const auto padding = digit_count && fs.width > length ? fs.width - length : 0; // Uncounted digits are known to fill width
+	const auto align = fs.align ? fs.align : fs.zero_pad ? '=' : '>';
+	const auto before = align == '<' || align == '=' ? 0 : align == '^' ? padding / 2 : padding;
+	out = std::ranges::fill_n(out, static_cast<std::ptrdiff_t>(before), fs.fill);
+	out = std::ranges::copy(prefix, out).out;
+	if(align == '=')
+		out = std::ranges::fill_n(out, static_cast<std::ptrdiff_t>(padding), '0');
+
+	auto remaining = digit_count;
+	bool any_written = false;
+	auto sink = [&](char* first, char* last) {
+		for(; first != last; ++first) {
+			if(any_written && !grouping.empty() && is_boundary(remaining))
+				*out++ = separator;
+			*out++ = upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(*first))) : *first;
+			any_written = true;
+			--remaining;
+		}
+		return true;
+	};
+	if(digits.empty())
+		__put_chars(sink, radix);
+	else
+		sink(digits.data(), digits.data() + digits.size());
+
+	if(align != '=')
+		out = std::ranges::fill_n(out, static_cast<std::ptrdiff_t>(padding - before), fs.fill);
+	return out;
+}
+
+#ifdef __cpp_lib_format
+template<std::uint32_t base, typename Allocator>
+constexpr std::format_parse_context::iterator std::formatter<BigInt<base, Allocator>, char>::parse(std::format_parse_context& ctx)
+{
+	const auto end = std::ranges::find(ctx, '}');
+	spec = std::string_view(ctx.begin(), end);
+	try {
+		BigInt<base, Allocator>::__parse_format_spec(spec);
+	} catch(const std::domain_error& e) {
+		throw std::format_error(e.what());
+	}
+	return end;
+}
+
+template<std::uint32_t base, typename Allocator>
+template<typename FormatContext>
+typename FormatContext::iterator std::formatter<BigInt<base, Allocator>, char>::format(const BigInt<base, Allocator>& bi, FormatContext& ctx) const
+{
+	return bi.format_to(ctx.out(), spec, ctx.locale());
+}
+#endif
+
+#endif // BIG_INT_FORMAT_FUNCTIONS_HPP
@@ -1,24 +1,147 @@
 #ifndef BIG_INT_FRIEND_FUNCTIONS_HPP
 #define BIG_INT_FRIEND_FUNCTIONS_HPP
 
+#include <algorithm>
+#include <cassert>
+
 #include "../big_int.hpp"
 #include "member_functions.hpp"
 #include "external_functions.hpp"
 
-template<std::uint32_t base>
-std::ostream& operator<<(std::ostream& os, const BigInt<base>& bi)
-{
-	return os << bi.str();
+template<std::uint32_t base, typename Allocator>
+std::ostream& operator<<(std::ostream& os, const BigInt<base, Allocator>& bi)
+{ // As for built-in integers: honours basefield (dec, hex or oct), showbase, showpos, uppercase, and width with fill and adjustfield.
+  // The digits go to the streambuf in blocks, rather than being built as one string first
+	const std::ostream::sentry sentry(os);
+	if(!sentry)
+		return os;
+	const auto flags = os.flags();
+	const auto basefield = flags & std::ios_base::basefield;
+	const int radix = basefield == std::ios_base::hex ? 16 : basefield == std::ios_base::oct ? 8 : 10;
+	const bool upper = flags & std::ios_base::uppercase;
+	std::string prefix = !bi.positive() && !bi.is_zero() ? "-" : flags & std::ios_base::showpos ? "+" : "";
+	if(flags & std::ios_base::showbase && !bi.is_zero() && radix != 10)
+		prefix += radix == 8 ? "0" : upper ? "0X" : "0x";
+	const auto width = static_cast<std::size_t>(std::max<std::streamsize>(os.width(0), 0));
+	auto& sb = *os.rdbuf();
+
+	std::uint8_t chars_per_chunk; // The digits number at least (N - 1) * chars_per_chunk + 1
+	const auto chunk = BigInt<base, Allocator>::__max_pow_in_bigit(radix, chars_per_chunk);
+	if(chunk > BigInt<base, Allocator>::true_base())
+		chars_per_chunk = 0;
+	bool written;
+	if(width <= prefix.size() + (bi.size() - 1) * chars_per_chunk + 1) { // No padding: stream the digits
+		auto sink = [&sb, upper](char* first, char* last) { return BigInt<base, Allocator>::__put_block(sb, first, last, upper); };
+		written = sink(prefix.data(), prefix.data() + prefix.size()) && bi.__put_chars(sink, radix);
+	} else { // Padding might be needed, so the digits are counted by building them first. There are at most about width of them
+		std::string digits(bi.chars_needed(radix), '\0');
+		const auto [end, ec] = bi.to_chars(digits.data(), digits.data() + digits.size(), radix);
+		assert(ec == std::errc{});
+		digits.erase(end - digits.data());
+		if(digits.front() == '-')
+			digits.erase(0, 1);
+		const auto fill_size = width - std::min(width, prefix.size() + digits.size());
+		const auto adjust = flags & std::ios_base::adjustfield;
+		if(adjust == std::ios_base::left)
+			digits.append(fill_size, os.fill());
+		else if(adjust == std::ios_base::internal)
+			digits.insert(0, fill_size, os.fill());
+		else
+			prefix.insert(0, fill_size, os.fill());
+		written = BigInt<base, Allocator>::__put_block(sb, prefix.data(), prefix.data() + prefix.size(), upper) &&
+		          BigInt<base, Allocator>::__put_block(sb, digits.data(), digits.data() + digits.size(), upper);
+	}
+	if(!written)
+		os.setstate(std::ios_base::badbit);
+	return os;
 }
 
-template<std::uint32_t base>
-std::istream& operator>>(std::istream& is, BigInt<base>& bi)
-{
-	std::string input;
-	is >> input;
-	bi = make_big_int<base>(input);
+template<std::uint32_t base, typename Allocator>
+std::istream& operator>>(std::istream& is, BigInt<base, Allocator>& bi)
+{ // An optional sign, then digits in the radix of basefield (dec, hex with an optional 0x, or oct), as for built-in integers. The digits are read
+  // from the streambuf a chunk at a time, each chunk being as many as fit in a bigit, then converted together. On failure, bi is unchanged
+	const std::istream::sentry sentry(is);
+	if(!sentry)
+		return is;
+	const auto basefield = is.flags() & std::ios_base::basefield;
+	const char radix = basefield == std::ios_base::hex ? 16 : basefield == std::ios_base::oct ? 8 : 10;
+	using traits = std::istream::traits_type;
+	auto& sb = *is.rdbuf();
+	auto ch = sb.sgetc();
+	const auto is_char = [&ch](const char c) { return traits::eq_int_type(ch, traits::to_int_type(c)); };
+
+	const bool neg = is_char('-');
+	if(neg || is_char('+'))
+		ch = sb.snextc();
+	bool any_digits = false;
+	if(radix == 16 && is_char('0')) {
+		any_digits = true;
+		ch = sb.snextc();
+		if(is_char('x') || is_char('X')) {
+			any_digits = false;
+			ch = sb.snextc();
+		}
+	}
+	while(is_char('0')) { // Leading zeros, so that the first chunk is the most significant
+		any_digits = true;
+		ch = sb.snextc();
+	}
+
+	const auto chars_per_bigit = BigInt<base, Allocator>::__int_log_of(BigInt<base, Allocator>::true_base(), radix);
+	std::uint8_t chars_per_chunk = chars_per_bigit;
+	const auto chunk_base = chars_per_bigit ? BigInt<base, Allocator>::true_base() : BigInt<base, Allocator>::__max_pow_in_bigit(radix, chars_per_chunk);
+	std::vector<std::uint32_t, Allocator> chunks(bi.get_allocator()); // Most significant first, until reversed
+	std::uint32_t chunk = 0, chunk_power = 1;
+	std::uint8_t chunk_chars = 0;
+	for(; !traits::eq_int_type(ch, traits::eof()) && BigInt<base, Allocator>::__valid_char(traits::to_char_type(ch), radix); ch = sb.snextc()) {
+		any_digits = true;
+		chunk = chunk * radix + BigInt<base, Allocator>::__char_value(traits::to_char_type(ch), radix);
+		chunk_power *= radix;
+		if(++chunk_chars == chars_per_chunk) {
+			chunks.push_back(chunk);
+			chunk = 0;
+			chunk_power = 1;
+			chunk_chars = 0;
+		}
+	}
+	auto state = traits::eq_int_type(ch, traits::eof()) ? std::ios_base::eofbit : std::ios_base::goodbit;
+	if(!any_digits) {
+		is.setstate(state | std::ios_base::failbit);
+		return is;
+	}
+
+	BigInt<base, Allocator> res(bi.get_allocator()); // Moved into bi, so its bigits can be taken over
+	if(!chunks.empty()) {
+		std::ranges::reverse(chunks);
+		res = chars_per_bigit ? BigInt<base, Allocator>::__from_bigits(chunks, bi.get_allocator()) : BigInt<base, Allocator>::__from_radix(chunks, chunk_base, bi.get_allocator());
+	}
+	if(chunk_chars) { // The least significant chars didn't fill a chunk
+		res.__mul_eq_signless(chunk_power);
+		res.__add_eq_signless(chunk);
+	}
+	res.negative = neg && !res.is_zero();
+	bi = std::move(res);
+	is.setstate(state);
 	return is;
 }
 
+template<std::uint32_t base, typename Allocator>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, BigInt<base, Allocator>& bi, const int radix)
+{ // An optional '-', then the longest run of digits valid in radix. bi is only modified on success
+	if(radix < 2 || 36 < radix)
+		throw std::domain_error(BigInt<base, Allocator>::__THROW_SV_BASE_DOMAIN);
+	auto idx = first;
+	if(idx != last && *idx == '-')
+		++idx;
+	const auto digits_start = idx;
+	while(idx != last && BigInt<base, Allocator>::__valid_char(*idx, static_cast<char>(radix)))
+		++idx;
+	if(idx == digits_start)
+		return { first, std::errc::invalid_argument };
+
+	bi = BigInt<base, Allocator>(std::string_view(first, idx), static_cast<char>(radix), bi.get_allocator());
+	return { idx, std::errc{} };
+}
+
 #endif // BIG_INT_FRIEND_FUNCTIONS_HPP
 
@@ -3,7 +3,10 @@
 
 #include <utility>
 #include <algorithm>
+#include <numeric>
 #include <iterator>
+#include <bit>
+#include <cctype>
 #include <cassert>
 
 #include "../big_int.hpp"
@@ -17,21 +20,24 @@
 #include "utility_functions.hpp"
 #include "external_functions.hpp"
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__sqrt_helper()
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__sqrt_helper()
 {
 	if constexpr(__int_log_of(true_base(), 2)) {
 		const auto bit_count = bits();
 		const auto max_size = (size() + 1) >> 1;
 
-		BigInt<base> bit{ 1 };
+		BigInt<base, Allocator> bit{ 1, get_allocator() };
 		bit <<= bit_count & 1u ? bit_count - 1 : bit_count - 2;
 	
 		auto this_copy{ *this - bit }; // Make first loop iteration faster
 		*this = bit;
 
+		BigInt<base, Allocator> sum(get_allocator()); // Reused, so nothing allocates in the loop
+		sum.reserve(std::max(size(), max_size) + 1);
 		while(bit >>= 2) { // Bit-by-bit calculation: O(N)
-			const auto sum{ *this + bit };
+			sum = *this;
+			sum += bit;
 			if(this_copy >= sum) {
 				this_copy -= sum;
 				*this >>= 1;
@@ -40,7 +46,7 @@ constexpr BigInt<base>& BigInt<base>::__sqrt_helper()
 				*this >>= 1;
 		}
 	} else { // Convert to a binary base, then re-call, then convert base back: O(N^2)
-		BigInt<MAX_BASE> this_bin_base{ clone() };
+		BigInt<MAX_BASE, Allocator> this_bin_base{ clone() };
 		return *this = this_bin_base.__sqrt_helper();
 	}
 
@@ -48,21 +54,197 @@ constexpr BigInt<base>& BigInt<base>::__sqrt_helper()
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__gcd_helper(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__pow_size(const std::uint64_t expo) const noexcept
+{ // An upper bound on the size of any product in pow(expo), or 0 if it would overflow. From |*this| < 2^bits, with at most ceil(log2(B)) bits in
+  // each bigit below the top, and at least floor(log2(B)) in each bigit of the power
+	const std::uint64_t max_bits = (size() - 1) * std::bit_width(true_base() - 1) + std::bit_width(back());
+	if(max_bits > std::numeric_limits<std::uint64_t>::max() / expo)
+		return 0;
+	return max_bits * expo / (std::bit_width(true_base()) - 1) + 2; // Products may have 1 bigit more than they need
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__gcd_helper(const BigInt<base, Allocator>& other)
 {
-	BigInt<base> r, other_copy{ other };
-	do {
-		r = *this % other_copy;
-		*this = other_copy;
-		other_copy = r;
-	} while(r);
+	BigInt<base, Allocator> r(get_allocator()), other_copy(other, get_allocator()); // Same allocator as *this, as their bigits are swapped
+	do { // Each step leaves the unused quotient in *this, then rotates the storage: (this, other_copy, r) = (other_copy, r, this)
+		__div_rem_eq_signless(other_copy, r);
+		bigits.swap(other_copy.bigits);
+		other_copy.bigits.swap(r.bigits);
+	} while(!other_copy.is_zero());
 
 	return abs();
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__not_helper()
+template<std::uint32_t base, typename Allocator>
+constexpr char* BigInt<base, Allocator>::__put_bigit(char* end, std::uint32_t bigit, const int radix, std::uint8_t width) noexcept
+{ // Writes the low width chars of bigit in radix, zero padded, so that they end at end, and returns where they start. Decimal and hexadecimal
+  // take 2 chars at a time from __DIGIT_PAIRS and __HEX_PAIRS, and other powers of 2 only shift and mask: O(width)
+	if(radix == 10) {
+		for(; width >= 2; width -= 2, bigit /= 100) {
+			end -= 2;
+			end[0] = __DIGIT_PAIRS[2 * (bigit % 100)];
+			end[1] = __DIGIT_PAIRS[2 * (bigit % 100) + 1];
+		}
+		if(width)
+			*--end = __DIGIT_CHARS[bigit % 10];
+	} else if(radix == 16) {
+		for(; width >= 2; width -= 2, bigit >>= 8) {
+			end -= 2;
+			end[0] = __HEX_PAIRS[2 * (bigit & 0xFF)];
+			end[1] = __HEX_PAIRS[2 * (bigit & 0xFF) + 1];
+		}
+		if(width)
+			*--end = __DIGIT_CHARS[bigit & 0xF];
+	} else if(std::has_single_bit(static_cast<unsigned>(radix))) {
+		const auto bits_per_char = std::countr_zero(static_cast<unsigned>(radix));
+		for(; width; --width, bigit >>= bits_per_char)
+			*--end = __DIGIT_CHARS[bigit & (radix - 1)];
+	} else
+		for(; width; --width, bigit /= radix)
+			*--end = __DIGIT_CHARS[bigit % radix];
+	return end;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr char* BigInt<base, Allocator>::__to_chars_power(char* first, char* last, std::span<const std::uint32_t> bi, const int radix, const std::uint8_t chars_per_bigit) noexcept
+{ // As __to_chars_short, for positive bi where B = radix^chars_per_bigit. Each bigit below the top one is exactly chars_per_bigit chars,
+  // so the length is known and the chars are written from the end: O(N)
+	std::size_t chars = (bi.size() - 1) * chars_per_bigit;
+	for(auto top = bi.back(); top; top /= radix)
+		++chars;
+	if(static_cast<std::size_t>(last - first) < chars)
+		return nullptr;
+	auto idx = first + chars;
+	for(const auto bigit : bi.first(bi.size() - 1))
+		idx = __put_bigit(idx, bigit, radix, chars_per_bigit);
+	idx = __put_bigit(idx, bi.back(), radix, static_cast<std::uint8_t>(idx - first));
+	assert(idx == first);
+	return first + chars;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr char* BigInt<base, Allocator>::__to_chars_short(char* first, char* last, std::span<std::uint32_t> bi, const int radix, const std::size_t width)
+{ // Writes positive bi in radix to [first, last), padded with zeros to width chars, returning the end of the chars or nullptr if they don't fit.
+  // Short division by C, the largest power of radix that fits in a bigit, least significant chars first. Overwrites bi: O(N^2)
+	std::uint8_t chars_per_chunk;
+	const auto chunk = __max_pow_in_bigit(radix, chars_per_chunk);
+	auto idx = first;
+	bool on_last;
+	do {
+		auto rem = __div_bigits_small(bi, chunk);
+		while(bi.size() > 1 && bi.back() == 0)
+			bi = bi.first(bi.size() - 1);
+		on_last = bi.size() == 1 && bi.front() == 0;
+		for(auto chars_left = chars_per_chunk; chars_left && (rem || !on_last); --chars_left, rem /= radix) { // Only pad below the top chunk
+			if(idx == last)
+				return nullptr;
+			*idx++ = __DIGIT_CHARS[rem % radix];
+		}
+	} while(!on_last);
+	for(; static_cast<std::size_t>(idx - first) < width; ++idx) {
+		if(idx == last)
+			return nullptr;
+		*idx = '0';
+	}
+	std::reverse(first, idx);
+	return idx;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr char* BigInt<base, Allocator>::__to_chars_helper(char* first, char* last, BigInt<base, Allocator> val, const int radix, std::span<const BigInt<base, Allocator>> powers, const std::size_t width)
+{ // As __to_chars_short, where powers[i] is C^(2^i). Recursively splits val by the largest power, as hi * C^(2^i) + lo: O(M(N) log N),
+  // where M(N) is the cost of multiplication
+	if(val.size() < __CONVERT_DC_THRESHOLD || powers.size() == 1)
+		return __to_chars_short(first, last, val.bigits, radix, width);
+
+	const auto lower_powers = powers.first(powers.size() - 1);
+	if(!width && val.__compare_signless(powers.back()) == __LESS_SO) // Top level: hi would be 0
+		return __to_chars_helper(first, last, std::move(val), radix, lower_powers, 0);
+
+	std::uint8_t chars_per_chunk;
+	__max_pow_in_bigit(radix, chars_per_chunk);
+	const auto lo_width = static_cast<std::size_t>(chars_per_chunk) << lower_powers.size();
+	assert(!width || width > lo_width);
+	BigInt<base, Allocator> lo(val.get_allocator());
+	val.__div_rem_eq_signless(powers.back(), lo);
+	first = __to_chars_helper(first, last, std::move(val), radix, lower_powers, width ? width - lo_width : 0);
+	return first ? __to_chars_helper(first, last, std::move(lo), radix, lower_powers, lo_width) : nullptr;
+}
+
+template<std::uint32_t base, typename Allocator>
+bool BigInt<base, Allocator>::__put_block(std::streambuf& sb, char* first, char* last, const bool upper)
+{ // Writes [first, last) to sb, in upper case if asked, returning whether every char was written
+	if(upper)
+		std::transform(first, last, first, [](const unsigned char c) { return static_cast<char>(std::toupper(c)); });
+	const auto count = static_cast<std::streamsize>(last - first);
+	return sb.sputn(first, count) == count;
+}
+
+template<std::uint32_t base, typename Allocator>
+template<typename Sink>
+bool BigInt<base, Allocator>::__put_chars_helper(Sink& sink, BigInt<base, Allocator> val, const int radix, std::span<const BigInt<base, Allocator>> powers, const std::size_t width,
+                                      std::string& block)
+{ // As __to_chars_helper, but each short conversion goes through block to sink, so the chars of val are never all held at once
+	if(val.size() < __CONVERT_DC_THRESHOLD || powers.size() == 1) {
+		block.resize(std::max(width, val.chars_needed(radix)));
+		const auto end = __to_chars_short(block.data(), block.data() + block.size(), val.bigits, radix, width);
+		assert(end);
+		return sink(block.data(), end);
+	}
+
+	const auto lower_powers = powers.first(powers.size() - 1);
+	if(!width && val.__compare_signless(powers.back()) == __LESS_SO) // Top level: hi would be 0
+		return __put_chars_helper(sink, std::move(val), radix, lower_powers, 0, block);
+
+	std::uint8_t chars_per_chunk;
+	__max_pow_in_bigit(radix, chars_per_chunk);
+	const auto lo_width = static_cast<std::size_t>(chars_per_chunk) << lower_powers.size();
+	assert(!width || width > lo_width);
+	BigInt<base, Allocator> lo(val.get_allocator());
+	val.__div_rem_eq_signless(powers.back(), lo);
+	return __put_chars_helper(sink, std::move(val), radix, lower_powers, width ? width - lo_width : 0, block) &&
+	       __put_chars_helper(sink, std::move(lo), radix, lower_powers, lo_width, block);
+}
+
+template<std::uint32_t base, typename Allocator>
+template<typename Sink>
+bool BigInt<base, Allocator>::__put_chars(Sink& sink, const int radix) const
+{ // Passes the chars of |*this| in radix to sink a block at a time, as to_chars would write them, returning false as soon as sink does
+	if(true_base() < static_cast<std::uint64_t>(radix)) // Radix chars wouldn't fit in a bigit: write from MAX_BASE instead
+		return BigInt<MAX_BASE, Allocator>(*this).__put_chars(sink, radix);
+	if(is_zero()) {
+		char zero = '0';
+		return sink(&zero, &zero + 1);
+	}
+
+	const auto chars_per_bigit = __int_log_of(true_base(), radix);
+	if(chars_per_bigit) { // Specialisation: the top bigit, then exactly chars_per_bigit chars for each bigit below it: O(N)
+		std::array<char, 1'024> block;
+		auto end = std::to_chars(block.data(), block.data() + block.size(), back(), radix).ptr;
+		for(const auto bigit : bigits | __REV_DROP1_V) {
+			if(block.data() + block.size() - end < chars_per_bigit) {
+				if(!sink(block.data(), end))
+					return false;
+				end = block.data();
+			}
+			end += chars_per_bigit;
+			__put_bigit(end, bigit, radix, chars_per_bigit);
+		}
+		return sink(block.data(), end);
+	}
+
+	std::uint8_t chars_per_chunk;
+	__BigIntVector powers(1, BigInt<base, Allocator>(static_cast<std::int64_t>(__max_pow_in_bigit(radix, chars_per_chunk)), get_allocator()), get_allocator());
+	while(size() >= __CONVERT_DC_THRESHOLD && 2 * powers.back().size() <= size())
+		powers.push_back(powers.back() * powers.back());
+	std::string block;
+	return __put_chars_helper(sink, std::move(clone().abs()), radix, powers, 0, block); // Moved, as a copy would take the default allocator
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__not_helper()
 {
 	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
 	constexpr std::uint8_t unused_bits_per_bigit = std::numeric_limits<std::uint32_t>::digits - bits_per_bigit;
@@ -83,9 +265,9 @@ constexpr BigInt<base>& BigInt<base>::__not_helper()
 	return *this;
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BitwiseType type> // AND = 0, OR = 1, XOR = 2
-constexpr BigInt<base>& BigInt<base>::__bitwise_signless(const BigInt<base>& other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__bitwise_signless(const BigInt<base, Allocator>& other)
 {
 	if constexpr(__int_log_of(true_base(), 2)) {
 		std::size_t used_idx = 0;
@@ -116,7 +298,7 @@ constexpr BigInt<base>& BigInt<base>::__bitwise_signless(const BigInt<base>& oth
 		if constexpr(type != BitwiseType::OR)
 			resize(used_idx + 1);
 	} else { // Convert to a binary base, then re-call, then convert base back: O(N^2)
-		BigInt<MAX_BASE> this_bin_base{ clone() }, other_bin_base{ other.clone() };
+		BigInt<MAX_BASE, Allocator> this_bin_base{ clone() }, other_bin_base{ other.clone() };
 		return *this = this_bin_base.template __bitwise_signless<type>(other_bin_base);
 	}
 
@@ -124,12 +306,12 @@ constexpr BigInt<base>& BigInt<base>::__bitwise_signless(const BigInt<base>& oth
 	return *this;
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BitwiseType type> // AND = 0, OR = 1, XOR = 2
-constexpr BigInt<base>& BigInt<base>::__bitwise_signless(const std::uint64_t other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__bitwise_signless(const std::uint64_t other)
 {
 	if(other >= true_base()) // other < true_base() required for specialisation
-		return __bitwise_signless<type>(make_big_int<base>(other));
+		return __bitwise_signless<type>(make_big_int<base, Allocator>(other, get_allocator()));
 
 	if constexpr(__int_log_of(true_base(), 2)) { // Specialisation: standard bitwise AND/OR/XOR: O(1)
 		const std::uint32_t other_u32 = other;
@@ -144,7 +326,7 @@ constexpr BigInt<base>& BigInt<base>::__bitwise_signless(const std::uint64_t oth
 		bigits[0] &= 1u;
 		resize(1);
 	} else { // Convert to a binary base, then re-call, then convert base back: O(N^2)
-		BigInt<MAX_BASE> this_bin_base{ clone() };
+		BigInt<MAX_BASE, Allocator> this_bin_base{ clone() };
 		return *this = this_bin_base.template __bitwise_signless<type>(other);
 	}
 
@@ -152,35 +334,25 @@ constexpr BigInt<base>& BigInt<base>::__bitwise_signless(const std::uint64_t oth
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__add_eq_signless(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__add_eq_signless(const BigInt<base, Allocator>& other)
 {
 	const auto max_new_size = std::max(size(), other.size()) + 1;
 	reserve(max_new_size); // Know we will be using at most max(size() + other.size()) + 1
 	resize(max_new_size - 1, 0); // Know we will be using at least max(size() + other.size())
 
-	std::uint64_t a, b, n = 0;
-	for(std::size_t idx = 0; idx != max_new_size - 1; ++idx) { // Standard carry (n) addition algorithm: O(N)
-		a = bigits[idx];
-		b = idx < other.size() ? other.bigits[idx] : 0;
-		n += a + b;
-		bigits[idx] = n % true_base();
-		n = n >= true_base();
-	}
-	if(n) { // We have overflowed: next bigit will be n
-		assert(n == 1); // ... which is always 1
+	if(__add_bigits(bigits, other.bigits)) // We have overflowed: next bigit will be the carry, which is always 1
 		bigits.push_back(1);
-	}
 
 	assert(valid());
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__add_eq_signless(const std::uint64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__add_eq_signless(const std::uint64_t other)
 {
 	if(other >= true_base()) // other < true_base() required for specialisation
-		return __add_eq_signless(make_big_int<base>(other));
+		return __add_eq_signless(make_big_int<base, Allocator>(other, get_allocator()));
 
 	auto n = other + front();
 	bigits[0] = n % true_base();
@@ -205,51 +377,40 @@ constexpr BigInt<base>& BigInt<base>::__add_eq_signless(const std::uint64_t othe
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__sub_eq_signless(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__sub_eq_signless(const BigInt<base, Allocator>& other)
 {
-	const auto max_new_size = std::max(size(), other.size());
-	reserve(max_new_size); // Know we will be using at most max_new_size
-
-	std::int64_t a, b, n = 0;
-	std::size_t used_idx = 0;
 	const auto larger = __compare_signless(other) != __LESS_SO;
-	for(std::size_t idx = 0; idx != max_new_size; ++idx) { // Standard borrowing (n) subtraction algorithm: O(N)
-		a = idx < size() ? bigits[idx] : 0;
-		b = idx < other.size() ? other.bigits[idx] : 0;
-		n += larger ? a - b : b - a;
-		const auto borrowed = n < 0;
-		const std::uint32_t val = borrowed ? n + true_base() : n;
-		if(idx < size())
-			bigits[idx] = val;
-		else
-			bigits.push_back(val);
-		if(val)
-			used_idx = idx;
-		n = -borrowed; // If n < 0 set to -1, otherwise 0
+	[[maybe_unused]] std::uint32_t borrow;
+	if(larger)
+		borrow = __sub_bigits(bigits, other.bigits);
+	else { // Subtract the other way around: other - *this
+		BigitVector<Allocator> diff_bigits(other.bigits, get_allocator());
+		borrow = __sub_bigits(diff_bigits, bigits);
+		bigits.swap(diff_bigits);
 	}
-	assert(n == 0);
-	if(used_idx != max_new_size - 1) // Chop off leading zeros
-		resize(used_idx + 1);
+	assert(borrow == 0);
+	while(back() == 0 && size() != 1) // Chop off leading zeros
+		bigits.pop_back();
 
 	negative ^= !larger;
 	assert(valid());
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__sub_eq_signless(const std::uint64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__sub_eq_signless(const std::uint64_t other)
 {
 	if(other >= true_base()) // other < true_base() required for specialisation
-		return __sub_eq_signless(make_big_int<base>(other));
+		return __sub_eq_signless(make_big_int<base, Allocator>(other, get_allocator()));
 
 	const auto larger = __compare_signless(other) != __LESS_SO;
-	auto n = larger ? static_cast<std::int64_t>(front()) - other : static_cast<std::int64_t>(other) - front();
+	std::int64_t n = larger ? static_cast<std::int64_t>(front()) - static_cast<std::int64_t>(other) : static_cast<std::int64_t>(other) - front();
 	auto borrowed = n < 0;
 	bigits[0] = borrowed ? n + true_base() : n;
 	n = -borrowed;
 
-	if(!borrowed) {
+	if(borrowed) {
 		for(auto& a : bigits | __DROP1_V) { // Standard borrowing (n) subtraction algorithm: O(N)
 			larger ? n += a : n -= a;
 			borrowed = n < 0;
@@ -259,135 +420,1465 @@ constexpr BigInt<base>& BigInt<base>::__sub_eq_signless(const std::uint64_t othe
 				break;
 		}
 		assert(n == 0);
-		if(back() == 0) // Can only possibly reduce size by 1
-			resize(size() - 1);
 	}
+	if(back() == 0 && size() != 1) // Can only possibly reduce size by 1
+		resize(size() - 1);
 
 	negative ^= !larger;
 	assert(valid());
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__mul_eq_signless(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__add_bigits(std::span<std::uint32_t> res, std::span<const std::uint32_t> other) noexcept
+{ // res += other, returning the carry out of res. Requires res.size() >= other.size()
+	assert(res.size() >= other.size());
+	std::size_t idx = 0;
+	if constexpr(base == MAX_BASE) { // Specialisation: the high word of the 64 bit sum is the carry, no comparisons needed
+		std::uint64_t carry = 0;
+		for(; idx != other.size(); ++idx) {
+			carry += static_cast<std::uint64_t>(res[idx]) + other[idx];
+			res[idx] = static_cast<std::uint32_t>(carry);
+			carry >>= 32;
+		}
+		for(; carry && idx != res.size(); ++idx)
+			carry = ++res[idx] == 0;
+		return carry;
+	}
+
+	std::uint64_t n = 0;
+	for(; idx != other.size(); ++idx) { // Standard carry (n) addition algorithm: O(N)
+		n += static_cast<std::uint64_t>(res[idx]) + other[idx];
+		res[idx] = n % true_base();
+		n = n >= true_base();
+	}
+	for(; n && idx != res.size(); ++idx) {
+		n += res[idx];
+		res[idx] = n % true_base();
+		n = n == true_base(); // Can only possibly overflow by 1, since n was previously 1
+	}
+	return n;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__sub_bigits(std::span<std::uint32_t> res, std::span<const std::uint32_t> other) noexcept
+{ // res -= other, returning the borrow out of res. Requires res.size() >= other.size()
+	assert(res.size() >= other.size());
+	std::size_t idx = 0;
+	if constexpr(base == MAX_BASE) { // Specialisation: native 64 bit wraparound, the difference's top bit being the borrow
+		std::uint64_t borrow = 0;
+		for(; idx != other.size(); ++idx) {
+			borrow = static_cast<std::uint64_t>(res[idx]) - other[idx] - borrow;
+			res[idx] = static_cast<std::uint32_t>(borrow);
+			borrow >>= 63;
+		}
+		for(; borrow && idx != res.size(); ++idx)
+			borrow = res[idx]-- == 0;
+		return borrow;
+	}
+
+	std::int64_t n = 0;
+	for(; idx != other.size(); ++idx) { // Standard borrowing (n) subtraction algorithm: O(N)
+		n += static_cast<std::int64_t>(res[idx]) - other[idx];
+		const auto borrowed = n < 0;
+		res[idx] = borrowed ? n + true_base() : n;
+		n = -borrowed; // If n < 0 set to -1, otherwise 0
+	}
+	for(; n && idx != res.size(); ++idx) {
+		n += res[idx];
+		const auto borrowed = n < 0;
+		res[idx] = borrowed ? n + true_base() : n;
+		n = -borrowed;
+	}
+	return n != 0;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__shl_bigits(std::span<std::uint32_t> res, std::span<const std::uint32_t> bi, const std::uint8_t shift) noexcept
+{ // res = bi << shift, returning the bits shifted out of the top bigit. For binary bases. Requires res.size() == bi.size() and shift < bits per bigit
+	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
+	static_assert(bits_per_bigit);
+	assert(res.size() == bi.size() && shift < bits_per_bigit);
+	if(shift == 0) {
+		std::ranges::copy(bi, res.begin());
+		return 0;
+	}
+
+	std::uint32_t carry = 0;
+	for(std::size_t idx = 0; idx != bi.size(); ++idx) { // Standard linear shift: O(N)
+		const std::uint64_t bigit = bi[idx];
+		res[idx] = ((bigit << shift) & (true_base() - 1)) | carry;
+		carry = bigit >> (bits_per_bigit - shift);
+	}
+	return carry;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__shr_bigits(std::span<std::uint32_t> bi, const std::uint8_t shift) noexcept
+{ // bi >>= shift. For binary bases. Requires shift < bits per bigit
+	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
+	static_assert(bits_per_bigit);
+	assert(shift < bits_per_bigit);
+	if(shift == 0 || bi.empty())
+		return;
+
+	for(std::size_t idx = 0; idx + 1 != bi.size(); ++idx) // Standard linear shift: O(N)
+		bi[idx] = (bi[idx] >> shift) | ((static_cast<std::uint64_t>(bi[idx + 1]) << (bits_per_bigit - shift)) & (true_base() - 1));
+	bi.back() >>= shift;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__mul_bigits_small(std::span<std::uint32_t> bi, const std::uint32_t factor) noexcept
+{ // bi *= factor, returning the carry out of the top bigit, which is less than factor
+	std::uint64_t carry = 0;
+	for(auto& bigit : bi) { // Standard short multiplication: O(N)
+		carry += static_cast<std::uint64_t>(factor) * bigit;
+		bigit = carry % true_base();
+		carry /= true_base();
+	}
+	return carry;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__div_bigits_small(std::span<std::uint32_t> bi, const std::uint64_t divisor) noexcept
+{ // bi /= divisor, returning the remainder. Requires 0 < divisor <= 2^64 / B, so that rem * B + bigit fits in a uint64_t
+	assert(0 < divisor && divisor <= std::numeric_limits<std::uint64_t>::max() / true_base());
+	std::uint64_t rem = 0;
+	for(auto& bigit : bi | __REV_V) { // Standard short division: O(N)
+		rem = rem * true_base() + bigit;
+		bigit = rem / divisor;
+		rem %= divisor;
+	}
+	return rem;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::span<const std::uint32_t> BigInt<base, Allocator>::__trim_bigits(std::span<const std::uint32_t> bi) noexcept
+{ // Drops leading zero bigits, leaving at least one
+	auto used_size = bi.size();
+	while(used_size > 1 && bi[used_size - 1] == 0)
+		--used_size;
+	return bi.first(used_size);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::__valid_bigits(std::span<const std::uint32_t> bi) noexcept
+{ // Non-empty, with no leading zero bigits, and each bigit less than B: O(N)
+	return bi.size() && (bi.back() || bi.size() == 1) && (base == 0 || std::ranges::all_of(bi, [](const auto bigit) {
+		return bigit < true_base();
+	}));
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::strong_ordering BigInt<base, Allocator>::__compare_bigits(std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi) noexcept
+{ // Compares bigit spans by value, which may have leading zeros
+	a_bi = __trim_bigits(a_bi);
+	b_bi = __trim_bigits(b_bi);
+	if(a_bi.size() != b_bi.size())
+		return a_bi.size() <=> b_bi.size();
+	for(auto idx = a_bi.size(); idx--;)
+		if(a_bi[idx] != b_bi[idx])
+			return a_bi[idx] <=> b_bi[idx];
+	return __EQUAL_SO;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::__from_bigits(std::span<const std::uint32_t> bi, const Allocator& alloc)
+{ // Constructs a positive BigInt from a bigit span, which may have leading zeros
+	const auto bi_trimmed = __trim_bigits(bi);
+	BigInt<base, Allocator> res(alloc);
+	if(!bi_trimmed.empty())
+		res.bigits.assign(bi_trimmed.begin(), bi_trimmed.end());
+	return res;
+}
+
+template<std::uint32_t base, typename Allocator>
+template<std::uint32_t other_base>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::__from_base(std::span<const std::uint32_t> bi, const Allocator& alloc)
+{ // Constructs a positive BigInt from the bigits of a BigInt<other_base, Allocator>. It and every temporary use alloc
+	constexpr auto other_true_base = BigInt<other_base, Allocator>::true_base();
+	constexpr auto root = __common_root(other_true_base, true_base());
+	if constexpr(root) { // Specialisation: both bases are powers of root, so regroup the base root digits: O(N)
+		constexpr auto digits_in = __int_log_of(other_true_base, root), digits_out = __int_log_of(true_base(), root);
+		BigInt<base, Allocator> res_bi(alloc);
+		auto& res = res_bi.bigits;
+		res.clear();
+		res.reserve(bi.size() * digits_in / digits_out + 1);
+		std::uint64_t bigit_out = 0, place = 1;
+		std::uint8_t digits_done = 0;
+		for(std::uint64_t bigit_in : bi)
+			for(std::uint8_t i = 0; i != digits_in; ++i) {
+				bigit_out += bigit_in % root * place;
+				bigit_in /= root;
+				place *= root;
+				if(++digits_done == digits_out) {
+					res.push_back(bigit_out);
+					bigit_out = 0;
+					place = 1;
+					digits_done = 0;
+				}
+			}
+		if(digits_done)
+			res.push_back(bigit_out);
+		while(res.back() == 0 && res.size() != 1)
+			res.pop_back();
+		return res_bi;
+	} else
+		return __from_radix(bi, other_true_base, alloc);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::__from_radix(std::span<const std::uint32_t> bi, const std::uint64_t radix, const Allocator& alloc)
+{ // Constructs a positive BigInt from the bigits of a value in another radix. Costs O(M(N) log N), where M(N) is the cost of multiplication
+	assert(!bi.empty() && radix > 1);
+	__BigIntVector powers(1, BigInt<base, Allocator>(static_cast<std::int64_t>(radix), alloc), alloc); // powers[i] = radix^(2^i), for every 2^i < bi.size()
+	while(bi.size() >= __CONVERT_DC_THRESHOLD && (std::size_t{ 1 } << powers.size()) < bi.size())
+		powers.push_back(powers.back() * powers.back());
+	return __from_radix_dc(bi, radix, powers, alloc);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::__from_radix_dc(std::span<const std::uint32_t> bi, const std::uint64_t radix, std::span<const BigInt<base, Allocator>> powers, const Allocator& alloc)
+{ // Splits bi at the largest power of 2 below its size, as hi * radix^k + lo, converting each half recursively
+	bi = __trim_bigits(bi); // The low half may have leading zeros
+	if(bi.size() < __CONVERT_DC_THRESHOLD) { // Horner's rule: O(N^2)
+		BigInt<base, Allocator> res{ bi.back(), alloc };
+		for(const auto bigit : bi | __REV_DROP1_V) {
+			res.__mul_eq_signless(radix);
+			res.__add_eq_signless(bigit);
+		}
+		return res;
+	}
+
+	const auto k_log = std::bit_width(bi.size() - 1) - 1;
+	const auto k = std::size_t{ 1 } << k_log;
+	auto res = __from_radix_dc(bi.subspan(k), radix, powers, alloc);
+	res *= powers[k_log];
+	res += __from_radix_dc(bi.first(k), radix, powers, alloc);
+	return res; // Moved, not copied, so the bigits stay with alloc
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__mul_bigits(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi, with every temporary, at every level, taken from scratch. Requires a_bi.size() <= b_bi.size(),
+  // res.size() == a_bi.size() + b_bi.size() and scratch.size() >= __mul_scratch_size(a_bi.size(), b_bi.size())
+	assert(a_bi.size() <= b_bi.size() && res.size() == a_bi.size() + b_bi.size() && scratch.size() >= __mul_scratch_size(a_bi.size(), b_bi.size()));
+	if(a_bi.data() == b_bi.data() && a_bi.size() == b_bi.size()) // Squaring: about half the work
+		__sqr_bigits(res, a_bi, scratch);
+	else if(a_bi.size() < __KARATSUBA_THRESHOLD)
+		__mul_bigits_long(res, a_bi, b_bi);
+	else if(a_bi.size() < __TOOM3_THRESHOLD)
+		__mul_bigits_karatsuba(res, a_bi, b_bi, scratch);
+	else if(a_bi.size() < __NTT_THRESHOLD || res.size() > __NTT_MAX_SIZE)
+		__mul_bigits_toom(res, a_bi, b_bi, scratch);
+	else
+		__mul_bigits_ntt(res, a_bi, b_bi, scratch);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__mul_scratch_size(const std::size_t a_size, const std::size_t b_size) noexcept
+{ // Bigits of scratch __mul_bigits needs for a_size by b_size bigits (a_size <= b_size), over all its levels. Follows the same choice of
+  // algorithm, and every operand's size is known in advance, so is exact. Squaring a_size bigits needs no more than multiplying them
+	assert(a_size <= b_size);
+	const auto chunked = [a_size, b_size] { // Each product of a_bi and a chunk, then its scratch. The last chunk may be shorter
+		const auto last_chunk = b_size % a_size;
+		return 2 * a_size + std::max(__mul_scratch_size(a_size, a_size), last_chunk ? __mul_scratch_size(last_chunk, a_size) : 0);
+	};
+	if(a_size < __KARATSUBA_THRESHOLD)
+		return 0;
+	else if(a_size < __TOOM3_THRESHOLD) {
+		if(a_size <= b_size / 2)
+			return chunked();
+		// z0 and z2 have all of scratch. Then it holds the sums of halves and z1, and the rest goes to z1's product
+		const auto h = b_size / 2, a_sum_size = std::max(h, a_size - h) + 1, b_sum_size = b_size - h + 1;
+		return std::max({ __mul_scratch_size(h, h), __mul_scratch_size(a_size - h, b_size - h),
+		                  2 * (a_sum_size + b_sum_size) + __mul_scratch_size(a_sum_size, b_sum_size) });
+	} else if(a_size < __NTT_THRESHOLD || a_size + b_size > __NTT_MAX_SIZE) { // As __mul_bigits_toom picks its variant
+		const auto k3 = (b_size + 2) / 3, k4 = (b_size + 3) / 4;
+		if(a_size >= __TOOM4_THRESHOLD && a_size > 3 * k4)
+			return __toom_scratch_size(7, k4);
+		else if(a_size > 2 * k3)
+			return __toom_scratch_size(5, k3);
+		else if(a_size > 2 * k4)
+			return __toom_scratch_size(4, k3);
+		else if(a_size > k4)
+			return __toom_scratch_size(5, k4);
+		return chunked();
+	}
+	return 6 * std::bit_ceil(a_size + b_size - 1); // The 3 convolutions, then the other operand's transform and the twiddles for each
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__mul_bigits_long(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi) noexcept
+{ // res = a_bi * b_bi. Requires res.size() == a_bi.size() + b_bi.size()
+	assert(res.size() == a_bi.size() + b_bi.size());
+	std::ranges::fill(res, 0);
+
+	if constexpr(base == MAX_BASE) { // Specialisation: 2 bigits of a_bi at a time as one 64 bit word, with 64x64 -> 128 bit products: half the passes over b_bi
+		for(std::size_t a_idx = 0; a_idx < a_bi.size(); a_idx += 2) {
+			const auto paired = a_idx + 1 != a_bi.size();
+			const auto a = a_bi[a_idx] | (paired ? std::uint64_t{ a_bi[a_idx + 1] } << 32 : 0);
+			std::uint64_t carry = 0, high;
+			for(std::size_t b_idx = 0; b_idx != b_bi.size(); ++b_idx) { // Can't overflow: (2^64 - 1)(2^32 - 1) + (2^32 - 1) + (2^64 - 1) < 2^96
+				auto& prod_bigit = res[a_idx + b_idx];
+				auto low = __mul_wide(a, b_bi[b_idx], high);
+				low += prod_bigit;
+				high += low < prod_bigit;
+				low += carry;
+				high += low < carry;
+				prod_bigit = static_cast<std::uint32_t>(low);
+				carry = (low >> 32) | (high << 32);
+			}
+			res[a_idx + b_bi.size()] = static_cast<std::uint32_t>(carry);
+			if(paired)
+				res[a_idx + b_bi.size() + 1] = carry >> 32;
+			else
+				assert(carry >> 32 == 0);
+		}
+		return;
+	}
+
+	std::uint64_t a, n;
+	for(std::size_t a_idx = 0; a_idx != a_bi.size(); ++a_idx) { // Standard long multiplication method: O(N^2)
+		a = a_bi[a_idx];
+		n = 0;
+		for(std::size_t b_idx = 0; b_idx != b_bi.size(); ++b_idx) { // n can't overflow: (B - 1)^2 + 2(B - 1) < B^2
+			auto& prod_bigit = res[a_idx + b_idx];
+			n += a * b_bi[b_idx] + prod_bigit;
+			prod_bigit = n % true_base();
+			n /= true_base();
+		}
+		res[a_idx + b_bi.size()] = n;
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__addmul_bigits_long(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi) noexcept
+{ // res += a_bi * b_bi, carrying each row of the long multiplication as far up res as it goes. Requires res.size() >= a_bi.size() + b_bi.size(),
+  // and the sum to fit in res
+	assert(res.size() >= a_bi.size() + b_bi.size());
+	std::uint64_t a, n;
+	for(std::size_t a_idx = 0; a_idx != a_bi.size(); ++a_idx) { // Standard long multiplication method: O(N^2)
+		a = a_bi[a_idx];
+		n = 0;
+		for(std::size_t b_idx = 0; b_idx != b_bi.size(); ++b_idx) { // n can't overflow: (B - 1)^2 + 2(B - 1) < B^2
+			auto& sum_bigit = res[a_idx + b_idx];
+			n += a * b_bi[b_idx] + sum_bigit;
+			sum_bigit = n % true_base();
+			n /= true_base();
+		}
+		for(auto idx = a_idx + b_bi.size(); n; ++idx) {
+			assert(idx != res.size());
+			n += res[idx];
+			res[idx] = n % true_base();
+			n /= true_base();
+		}
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::__submul_bigits_long(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi) noexcept
+{ // res -= a_bi * b_bi modulo B^res.size(), returning whether it borrowed past the top, i.e. whether the product was larger.
+  // Requires res.size() >= a_bi.size() + b_bi.size()
+	assert(res.size() >= a_bi.size() + b_bi.size());
+	const auto sub_bigit = [](std::uint32_t& diff_bigit, std::uint64_t& n) { // Subtracts the low bigit of n, leaving the rest and the borrow in n
+		const auto sub = n % true_base();
+		n /= true_base();
+		if(diff_bigit < sub) {
+			diff_bigit = static_cast<std::uint32_t>(diff_bigit + true_base() - sub);
+			++n;
+		} else
+			diff_bigit -= static_cast<std::uint32_t>(sub);
+	};
+
+	auto borrowed = false;
+	std::uint64_t a, n;
+	for(std::size_t a_idx = 0; a_idx != a_bi.size(); ++a_idx) { // As long multiplication, subtracting each bigit of the product as it is made: O(N^2)
+		a = a_bi[a_idx];
+		n = 0;
+		for(std::size_t b_idx = 0; b_idx != b_bi.size(); ++b_idx) { // n can't overflow: (B - 1)^2 + B < B^2
+			n += a * b_bi[b_idx];
+			sub_bigit(res[a_idx + b_idx], n);
+		}
+		for(auto idx = a_idx + b_bi.size(); n && idx != res.size(); ++idx)
+			sub_bigit(res[idx], n);
+		borrowed |= n != 0; // Between all rows, at most 1 is borrowed past the top
+	}
+	return borrowed;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__sqr_bigits(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi^2, with every temporary taken from scratch. Requires res.size() == 2 * a_bi.size() and
+  // scratch.size() >= __mul_scratch_size(a_bi.size(), a_bi.size())
+	assert(res.size() == 2 * a_bi.size() && scratch.size() >= __mul_scratch_size(a_bi.size(), a_bi.size()));
+	if(a_bi.size() < __KARATSUBA_THRESHOLD)
+		__sqr_bigits_long(res, a_bi);
+	else if(a_bi.size() < __TOOM3_THRESHOLD)
+		__sqr_bigits_karatsuba(res, a_bi, scratch);
+	else if(a_bi.size() < __NTT_THRESHOLD || res.size() > __NTT_MAX_SIZE) // Toom-3 or Toom-4, squaring pointwise
+		__mul_bigits_toom(res, a_bi, a_bi, scratch);
+	else
+		__mul_bigits_ntt(res, a_bi, a_bi, scratch);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__sqr_bigits_long(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi) noexcept
+{ // res = a_bi^2. Requires res.size() == 2 * a_bi.size()
+	assert(res.size() == 2 * a_bi.size());
+	std::ranges::fill(res, 0);
+
+	std::uint64_t a, n;
+	if constexpr(base == MAX_BASE) { // Specialisation: as in __mul_bigits_long, 2 bigits a_i, a_i+1 at a time as one 64 bit word
+		for(std::size_t a_idx = 0; a_idx + 1 < a_bi.size(); a_idx += 2) {
+			const std::uint64_t a_lo = a_bi[a_idx], a_hi = a_bi[a_idx + 1];
+			a = a_lo | a_hi << 32;
+			n = a_lo * a_hi + res[2 * a_idx + 1]; // The one cross product within the pair, a_i * a_i+1
+			res[2 * a_idx + 1] = static_cast<std::uint32_t>(n);
+			n >>= 32;
+			std::uint64_t high;
+			for(auto b_idx = a_idx + 2; b_idx != a_bi.size(); ++b_idx) { // Can't overflow: (2^64 - 1)(2^32 - 1) + (2^32 - 1) + (2^64 - 1) < 2^96
+				auto& prod_bigit = res[a_idx + b_idx];
+				auto low = __mul_wide(a, a_bi[b_idx], high);
+				low += prod_bigit;
+				high += low < prod_bigit;
+				low += n;
+				high += low < n;
+				prod_bigit = static_cast<std::uint32_t>(low);
+				n = (low >> 32) | (high << 32);
+			}
+			res[a_idx + a_bi.size()] = static_cast<std::uint32_t>(n);
+			res[a_idx + a_bi.size() + 1] = n >> 32;
+		}
+	} else
+		for(std::size_t a_idx = 0; a_idx + 1 < a_bi.size(); ++a_idx) { // Each cross product a_i * a_j (i < j) once: O(N^2 / 2)
+			a = a_bi[a_idx];
+			n = 0;
+			for(auto b_idx = a_idx + 1; b_idx != a_bi.size(); ++b_idx) {
+				auto& prod_bigit = res[a_idx + b_idx];
+				n += a * a_bi[b_idx] + prod_bigit;
+				prod_bigit = n % true_base();
+				n /= true_base();
+			}
+			res[a_idx + a_bi.size()] = n;
+		}
+	[[maybe_unused]] const auto carry = __add_bigits(res, res); // Double the cross products
+	assert(carry == 0);
+
+	n = 0;
+	for(std::size_t a_idx = 0; a_idx != a_bi.size(); ++a_idx) { // Add the squares a_i^2 along the diagonal: O(N)
+		a = a_bi[a_idx];
+		n += a * a + res[2 * a_idx];
+		res[2 * a_idx] = n % true_base();
+		n /= true_base();
+		n += res[2 * a_idx + 1];
+		res[2 * a_idx + 1] = n % true_base();
+		n /= true_base();
+	}
+	assert(n == 0);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__sqr_bigits_karatsuba(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi^2, with temporaries taken from scratch. Requires res.size() == 2 * a_bi.size() and scratch.size() >= __mul_scratch_size(a_bi.size(), a_bi.size())
+	static_assert(__KARATSUBA_THRESHOLD >= 4);
+	assert(res.size() == 2 * a_bi.size() && scratch.size() >= __mul_scratch_size(a_bi.size(), a_bi.size()));
+
+	// Split a = a1 * B^h + a0. Then a^2 = z2 * B^2h + z1 * B^h + z0 where z0 = a0^2, z2 = a1^2, z1 = (a0 + a1)^2 - z0 - z2
+	const auto h = a_bi.size() / 2;
+	const auto a0 = a_bi.first(h), a1 = a_bi.subspan(h);
+	const auto z0 = res.first(2 * h), z2 = res.subspan(2 * h);
+	__sqr_bigits(z0, a0, scratch);
+	__sqr_bigits(z2, a1, scratch);
+
+	const auto a_sum = scratch.first(a1.size() + 1); // a1 is at least as long as a0
+	std::ranges::fill(a_sum, 0);
+	std::ranges::copy(a1, a_sum.begin());
+	__add_bigits(a_sum, a0);
+
+	const auto z1 = scratch.subspan(a_sum.size(), 2 * a_sum.size()); // The sum keeps its top bigit, so the size of its square is known in advance
+	__sqr_bigits(z1, a_sum, scratch.subspan(a_sum.size() + z1.size()));
+	__sub_bigits(z1, __trim_bigits(z0));
+	__sub_bigits(z1, __trim_bigits(z2));
+
+	[[maybe_unused]] const auto carry = __add_bigits(res.subspan(h), __trim_bigits(z1));
+	assert(carry == 0);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__mul_bigits_chunked(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi, by multiplying a_bi by each a_bi-sized chunk of b_bi and summing the products. Used when b_bi is much longer than a_bi.
+  // Each product goes in the first 2 * a_bi.size() bigits of scratch, and the rest is passed on to the multiplications
+	assert(a_bi.size() <= b_bi.size() && res.size() == a_bi.size() + b_bi.size() && scratch.size() >= __mul_scratch_size(a_bi.size(), b_bi.size()));
+	std::ranges::fill(res, 0);
+
+	const auto prod = scratch.first(2 * a_bi.size()), prod_scratch = scratch.subspan(prod.size());
+	for(std::size_t offset = 0; offset < b_bi.size(); offset += a_bi.size()) {
+		const auto chunk = b_bi.subspan(offset, std::min(a_bi.size(), b_bi.size() - offset));
+		const auto prod_span = prod.first(a_bi.size() + chunk.size());
+		if(chunk.size() < a_bi.size())
+			__mul_bigits(prod_span, chunk, a_bi, prod_scratch);
+		else
+			__mul_bigits(prod_span, a_bi, chunk, prod_scratch);
+		[[maybe_unused]] const auto carry = __add_bigits(res.subspan(offset), __trim_bigits(prod_span));
+		assert(carry == 0);
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__mul_bigits_karatsuba(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi, with temporaries taken from scratch. Requires a_bi.size() <= b_bi.size(), res.size() == a_bi.size() + b_bi.size()
+  // and scratch.size() >= __mul_scratch_size(a_bi.size(), b_bi.size())
+	static_assert(__KARATSUBA_THRESHOLD >= 4);
+	assert(a_bi.size() <= b_bi.size() && res.size() == a_bi.size() + b_bi.size() && scratch.size() >= __mul_scratch_size(a_bi.size(), b_bi.size()));
+
+	if(a_bi.size() <= b_bi.size() / 2) // Unbalanced: split b_bi into a_bi-sized chunks
+		return __mul_bigits_chunked(res, a_bi, b_bi, scratch);
+
+	// Split a = a1 * B^h + a0 and b = b1 * B^h + b0. Then a * b = z2 * B^2h + z1 * B^h + z0 where:
+	//   z0 = a0 * b0, z2 = a1 * b1, z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+	const auto h = b_bi.size() / 2; // a_bi.size() > h, so a1 is never empty
+	const auto a0 = a_bi.first(h), a1 = a_bi.subspan(h);
+	const auto b0 = b_bi.first(h), b1 = b_bi.subspan(h);
+	const auto z0 = res.first(2 * h), z2 = res.subspan(2 * h);
+	__mul_bigits(z0, a0, b0, scratch);
+	__mul_bigits(z2, a1, b1, scratch); // a1.size() <= b1.size() since a_bi.size() <= b_bi.size()
+
+	const auto a_sum = scratch.first(std::max(a0.size(), a1.size()) + 1), b_sum = scratch.subspan(a_sum.size(), b1.size() + 1); // b1 is at least as long as b0
+	std::ranges::fill(scratch.first(a_sum.size() + b_sum.size()), 0);
+	std::ranges::copy(a1, a_sum.begin());
+	std::ranges::copy(b1, b_sum.begin());
+	__add_bigits(a_sum, a0);
+	__add_bigits(b_sum, b0);
+
+	// The sums keep their top bigits, so the size of every product, and of its scratch, is known in advance
+	const auto sums_size = a_sum.size() + b_sum.size();
+	const auto z1 = scratch.subspan(sums_size, sums_size);
+	__mul_bigits(z1, a_sum, b_sum, scratch.subspan(2 * sums_size)); // a_sum is no longer than b_sum
+	__sub_bigits(z1, __trim_bigits(z0));
+	__sub_bigits(z1, __trim_bigits(z2));
+
+	[[maybe_unused]] const auto carry = __add_bigits(res.subspan(h), __trim_bigits(z1));
+	assert(carry == 0);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__mul_bigits_toom(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi, picking the Toom-Cook variant that best matches the operand sizes
+	static_assert(__TOOM3_THRESHOLD >= 16 && __TOOM4_THRESHOLD >= __TOOM3_THRESHOLD); // Every part must be non-empty
+	static_assert(__TOOM3_THRESHOLD > 2 * __toom_eval_size(0)); // Balanced parts are about a third of a_bi, so padded evaluations still shrink
+	assert(a_bi.size() <= b_bi.size() && res.size() == a_bi.size() + b_bi.size());
+
+	const auto k3 = (b_bi.size() + 2) / 3, k4 = (b_bi.size() + 3) / 4; // Part sizes when splitting b_bi into 3 and 4
+	if(a_bi.size() >= __TOOM4_THRESHOLD && a_bi.size() > 3 * k4)
+		__mul_bigits_toom<4, 4>(res, a_bi, b_bi, k4, scratch);
+	else if(a_bi.size() > 2 * k3)
+		__mul_bigits_toom<3, 3>(res, a_bi, b_bi, k3, scratch);
+	else if(a_bi.size() > 2 * k4)
+		__mul_bigits_toom<2, 3>(res, a_bi, b_bi, k3, scratch);
+	else if(a_bi.size() > k4)
+		__mul_bigits_toom<2, 4>(res, a_bi, b_bi, k4, scratch);
+	else // Too unbalanced for any variant: split b_bi into a_bi-sized chunks
+		__mul_bigits_chunked(res, a_bi, b_bi, scratch);
+}
+
+template<std::uint32_t base, typename Allocator>
+template<std::size_t a_parts, std::size_t b_parts>
+constexpr void BigInt<base, Allocator>::__mul_bigits_toom(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, const std::size_t k, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi. Splits a_bi into a_parts and b_bi into b_parts parts of k bigits, treating each as a polynomial in B^k.
+  // The product polynomial is found by evaluating at points, multiplying pointwise, then interpolating: O(N^1.47) for Toom-3.
+  // Values at the points are kept in scratch as magnitudes, with their signs alongside. Requires scratch.size() >= __toom_scratch_size(points, k)
+	constexpr auto points = a_parts + b_parts - 1;
+	static_assert(points == 4 || points == 5 || points == 7);
+	constexpr auto finite_points = [] {
+		if constexpr(points == 4)
+			return std::array<std::int64_t, 2>{ 1, -1 };
+		else if constexpr(points == 5)
+			return std::array<std::int64_t, 3>{ 1, -1, 2 };
+		else
+			return std::array<std::int64_t, 5>{ 1, -1, 2, -2, 3 };
+	}();
+	assert(res.size() == a_bi.size() + b_bi.size() && scratch.size() >= __toom_scratch_size(points, k));
+	assert((a_parts - 1) * k < a_bi.size() && a_bi.size() <= a_parts * k);
+	assert((b_parts - 1) * k < b_bi.size() && b_bi.size() <= b_parts * k);
+
+	// Evaluations are padded to w bigits, so every pointwise product is of w by w bigits, and needs the same scratch
+	const auto w = __toom_eval_size(k);
+	std::array<std::span<std::uint32_t>, points> vals; // Ordered as 0, finite_points..., infinity
+	std::array<bool, points> negative{};
+	for(std::size_t idx = 0; idx != points; ++idx)
+		vals[idx] = scratch.subspan(idx * 2 * w, 2 * w);
+	const auto rest = scratch.subspan(points * 2 * w);
+	const auto a_val = rest.first(w), b_val = rest.subspan(w, w), prod_scratch = rest.subspan(2 * w);
+
+	const auto evaluate = [k, &finite_points](std::span<std::uint32_t> val, std::span<const std::uint32_t> bi, const std::size_t point_idx) {
+		const auto parts = (bi.size() + k - 1) / k;
+		std::ranges::fill(val, 0);
+		if(point_idx == points - 1) { // Infinity: the top part
+			std::ranges::copy(bi.subspan((parts - 1) * k), val.begin());
+			return false;
+		}
+		const auto point = point_idx ? finite_points[point_idx - 1] : 0;
+		auto val_negative = false;
+		for(auto idx = parts; idx--;) { // Horner's method: O(N)
+			[[maybe_unused]] const auto carry = __mul_bigits_small(val, static_cast<std::uint32_t>(__constexpr_abs(point)));
+			assert(carry == 0);
+			val_negative = val_negative != (point < 0);
+			__add_signed_bigits(val, val_negative, bi.subspan(idx * k, std::min(k, bi.size() - idx * k)), false);
+		}
+		return val_negative;
+	};
+	const auto squaring = a_parts == b_parts && a_bi.data() == b_bi.data() && a_bi.size() == b_bi.size(); // Evaluate once, square pointwise
+	for(std::size_t idx = 0; idx != points; ++idx) {
+		const auto a_negative = evaluate(a_val, a_bi, idx);
+		if(squaring)
+			__mul_bigits(vals[idx], a_val, a_val, prod_scratch);
+		else {
+			negative[idx] = a_negative != evaluate(b_val, b_bi, idx);
+			__mul_bigits(vals[idx], a_val, b_val, prod_scratch);
+		}
+	}
+
+	__toom_interpolate(vals, negative, rest); // vals now hold the product polynomial's coefficients
+	std::ranges::fill(res, 0);
+	for(std::size_t idx = 0; idx != points; ++idx) {
+		const auto coeff = __trim_bigits(vals[idx]);
+		assert(!negative[idx] || (coeff.size() == 1 && coeff.front() == 0));
+		[[maybe_unused]] const auto carry = __add_bigits(res.subspan(idx * k), coeff);
+		assert(carry == 0);
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+template<std::size_t points>
+constexpr void BigInt<base, Allocator>::__toom_interpolate(std::array<std::span<std::uint32_t>, points>& vals, std::array<bool, points>& negative, std::span<std::uint32_t> scratch) noexcept
+{ // Converts a polynomial's values at 0, the finite points used in __mul_bigits_toom, and infinity, into its coefficients. Each value is a
+  // magnitude and a sign, all of one size, and up to 2 temporaries of that size are taken from scratch
+	const auto size = vals.front().size();
+	const auto tmp = scratch.first(size);
+	auto tmp_negative = false;
+	assert(scratch.size() >= (points == 7 ? 2 : 1) * size);
+	const auto add = [](std::span<std::uint32_t> val, bool& val_negative, std::span<const std::uint32_t> other, const bool other_negative) {
+		__add_signed_bigits(val, val_negative, other, other_negative);
+	};
+	const auto sub = [](std::span<std::uint32_t> val, bool& val_negative, std::span<const std::uint32_t> other, const bool other_negative) {
+		__add_signed_bigits(val, val_negative, other, !other_negative);
+	};
+	const auto to_tmp = [&tmp, &tmp_negative](std::span<const std::uint32_t> val, const bool val_negative, const std::uint32_t factor = 1) { // tmp = val * factor
+		std::ranges::copy(val, tmp.begin());
+		tmp_negative = val_negative;
+		[[maybe_unused]] const auto carry = __mul_bigits_small(tmp, factor);
+		assert(carry == 0);
+	};
+
+	if constexpr(points == 4) { // Points 0, 1, -1, inf
+		auto& [c0, c1, c2, c3] = vals;
+		auto& [n0, n1, n2, n3] = negative;
+		to_tmp(c1, n1);
+		sub(c1, n1, c2, n2);
+		__div_exact_bigits<2>(c1); // (v(1) - v(-1)) / 2 = c1 + c3
+		add(c2, n2, tmp, tmp_negative);
+		__div_exact_bigits<2>(c2); // (v(1) + v(-1)) / 2 = c0 + c2
+		sub(c1, n1, c3, n3);
+		sub(c2, n2, c0, n0);
+	} else if constexpr(points == 5) { // Points 0, 1, -1, 2, inf
+		auto& [c0, c1, c2, c3, c4] = vals;
+		auto& [n0, n1, n2, n3, n4] = negative;
+		sub(c3, n3, c2, n2);
+		__div_exact_bigits<3>(c3); // c1 + c2 + 3 c3 + 5 c4
+		sub(c2, n2, c1, n1);
+		n2 = !n2;
+		__div_exact_bigits<2>(c2); // c1 + c3
+		sub(c1, n1, c0, n0); // c1 + c2 + c3 + c4
+		sub(c3, n3, c1, n1);
+		__div_exact_bigits<2>(c3); // c3 + 2 c4
+		sub(c1, n1, c2, n2);
+		sub(c1, n1, c4, n4);
+		to_tmp(c4, n4, 2);
+		sub(c3, n3, tmp, tmp_negative);
+		sub(c2, n2, c3, n3);
+		std::swap(c1, c2);
+		std::swap(n1, n2);
+	} else { // Points 0, 1, -1, 2, -2, 3, inf
+		static_assert(points == 7);
+		auto& [c0, c1, c2, c3, c4, c5, c6] = vals;
+		auto& [n0, n1, n2, n3, n4, n5, n6] = negative;
+		// Remove c0 and c6, then divide by the point, leaving q(x) = c1 + c2 x + c3 x^2 + c4 x^3 + c5 x^4
+		sub(c1, n1, c0, n0);
+		sub(c1, n1, c6, n6); // q(1)
+		sub(c2, n2, c0, n0);
+		n2 = !n2;
+		add(c2, n2, c6, n6); // q(-1)
+		to_tmp(c6, n6, 64);
+		sub(c3, n3, c0, n0);
+		sub(c3, n3, tmp, tmp_negative);
+		__div_exact_bigits<2>(c3); // q(2)
+		sub(c4, n4, c0, n0);
+		n4 = !n4;
+		add(c4, n4, tmp, tmp_negative);
+		__div_exact_bigits<2>(c4); // q(-2)
+		to_tmp(c6, n6, 729);
+		sub(c5, n5, c0, n0);
+		sub(c5, n5, tmp, tmp_negative);
+		__div_exact_bigits<3>(c5); // q(3)
+
+		// Split into even and odd parts, in place: c1 + c3 + c5, c2 + c4, c1 + 4 c3 + 16 c5, c2 + 4 c4
+		to_tmp(c1, n1);
+		add(c1, n1, c2, n2);
+		__div_exact_bigits<2>(c1);
+		sub(c2, n2, tmp, tmp_negative);
+		n2 = !n2;
+		__div_exact_bigits<2>(c2);
+		to_tmp(c3, n3);
+		add(c3, n3, c4, n4);
+		__div_exact_bigits<2>(c3);
+		sub(c4, n4, tmp, tmp_negative);
+		n4 = !n4;
+		__div_exact_bigits<4>(c4);
+
+		sub(c4, n4, c2, n2);
+		__div_exact_bigits<3>(c4);
+		sub(c2, n2, c4, n4);
+		to_tmp(c2, n2, 3); // c1 + 9 c3 + 81 c5, once c2 and c4 are removed
+		sub(c5, n5, tmp, tmp_negative);
+		to_tmp(c4, n4, 27);
+		sub(c5, n5, tmp, tmp_negative);
+
+		const auto diff = scratch.subspan(size, size); // c3 + 5 c5, once divided
+		auto diff_negative = n3;
+		std::ranges::copy(c3, diff.begin());
+		sub(diff, diff_negative, c1, n1);
+		__div_exact_bigits<3>(diff);
+		sub(c5, n5, c3, n3);
+		__div_exact_bigits<5>(c5); // c3 + 13 c5
+		sub(c5, n5, diff, diff_negative);
+		__div_exact_bigits<8>(c5);
+		to_tmp(c5, n5, 5);
+		std::ranges::copy(diff, c3.begin());
+		n3 = diff_negative;
+		sub(c3, n3, tmp, tmp_negative);
+		sub(c1, n1, c3, n3);
+		sub(c1, n1, c5, n5);
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__toom_eval_size(const std::size_t k) noexcept
+{ // Bigits for a Toom-Cook evaluation of k bigit parts. Evaluations are below 40 B^k, but room for 2^12 B^k leaves room for 2^24 B^2k in their
+  // products, which every step of interpolation stays below
+	return k + __int_size(1 << 12);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__toom_scratch_size(const std::size_t points, const std::size_t k) noexcept
+{ // Bigits of scratch for __mul_bigits_toom with points points and k bigit parts: the value at each point, then either the evaluations and their
+  // product's scratch, or interpolation's temporaries
+	const auto w = __toom_eval_size(k);
+	return points * 2 * w + std::max(2 * w + __mul_scratch_size(w, w), (points == 7 ? 2 : 1) * 2 * w);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__add_signed_bigits(std::span<std::uint32_t> res, bool& res_negative, std::span<const std::uint32_t> other, const bool other_negative) noexcept
+{ // res += other, where each is a magnitude with a sign. Requires res.size() >= other.size(), and the sum to fit in res
+	if(res_negative == other_negative) {
+		[[maybe_unused]] const auto carry = __add_bigits(res, other);
+		assert(carry == 0);
+	} else if(__sub_bigits(res, other)) { // other was larger, so res holds B^res.size() - |sum|
+		__negate_bigits(res);
+		res_negative = other_negative;
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__negate_bigits(std::span<std::uint32_t> bi) noexcept
+{ // bi = B^bi.size() - bi, leaving 0 as it is: O(N)
+	std::uint64_t borrow = 0;
+	for(auto& bigit : bi) {
+		const auto n = bigit + borrow;
+		bigit = n ? static_cast<std::uint32_t>(true_base() - n) : 0;
+		borrow = n != 0;
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+template<std::uint32_t divisor>
+constexpr void BigInt<base, Allocator>::__div_exact_bigits(std::span<std::uint32_t> bi) noexcept
+{ // bi /= divisor, assuming there is no remainder. Used for Toom-Cook interpolation
+	static_assert(1 < divisor && divisor < (1u << 16)); // Small constants only, so q * divisor fits in an int64_t
+	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2), divisor_bits = __int_log_of(divisor, 2);
+	if constexpr(std::gcd(static_cast<std::uint64_t>(divisor), true_base()) == 1) { // Specialisation: Jebelean's exact division, no division required: O(N)
+		constexpr std::uint64_t inverse = __inverse_mod_base(divisor);
+		constexpr auto true_base_i64 = static_cast<std::int64_t>(true_base());
+		std::int64_t n = 0; // Borrow
+		for(auto& bigit : bi) { // Computes each quotient bigit from the bottom, as q = (a - borrow) * divisor^-1 (mod B)
+			const auto a = static_cast<std::int64_t>(bigit) - n;
+			const auto a_mod = a % true_base_i64 + (a < 0 ? true_base_i64 : 0);
+			const auto q = static_cast<std::uint64_t>(a_mod) * inverse % true_base();
+			bigit = q;
+			n = (static_cast<std::int64_t>(q * divisor) - a) / true_base_i64; // q * divisor = a (mod B), and q * divisor >= a
+		}
+		assert(n == 0);
+	} else if constexpr(divisor_bits && divisor_bits < bits_per_bigit) // Specialisation: divisor is a power of 2
+		__shr_bigits(bi, divisor_bits);
+	else {
+		[[maybe_unused]] const auto rem = __div_bigits_small(bi, divisor);
+		assert(rem == 0);
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__mul_bigits_ntt(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi, by convolving the bigits modulo 3 primes with number-theoretic transforms, then recombining with the CRT: O(N log N)
+  // Each convolution term is less than min(a_bi.size(), b_bi.size()) * B^2 <= 2^27 * 2^64, which is below the product of the primes (~2^95).
+  // The 3 convolutions, then each one's temporaries, are taken from scratch, which must have 6 * ntt_size bigits
+	const auto ntt_size = std::bit_ceil(res.size() - 1);
+	assert(res.size() == a_bi.size() + b_bi.size() && res.size() <= __NTT_MAX_SIZE && scratch.size() >= 6 * ntt_size);
+	const auto r1 = scratch.first(ntt_size), r2 = scratch.subspan(ntt_size, ntt_size), r3 = scratch.subspan(2 * ntt_size, ntt_size);
+	const auto convolve_scratch = scratch.subspan(3 * ntt_size);
+	__ntt_convolve<__NTT_MOD1, __NTT_ROOT1>(r1, a_bi, b_bi, convolve_scratch);
+	__ntt_convolve<__NTT_MOD2, __NTT_ROOT2>(r2, a_bi, b_bi, convolve_scratch);
+	__ntt_convolve<__NTT_MOD3, __NTT_ROOT3>(r3, a_bi, b_bi, convolve_scratch);
+
+	// Garner's algorithm: x = r1 + p1 * t2 + p1 * p2 * t3, where each t is reduced by its own prime
+	constexpr std::uint64_t p1 = __NTT_MOD1, p2 = __NTT_MOD2, p3 = __NTT_MOD3;
+	constexpr std::uint64_t p1_inv_p2 = __pow_mod(p1, p2 - 2, p2), // Inverses by Fermat's little theorem
+	                        p1_inv_p3 = __pow_mod(p1, p3 - 2, p3),
+	                        p2_inv_p3 = __pow_mod(p2, p3 - 2, p3);
+	std::array<std::uint32_t, 4> carry{}; // Little-endian base 2^32 words. Stays below 2^97, since each x < 2^96
+	const auto mul_add = [](std::array<std::uint32_t, 4>& words, const std::uint64_t mul, std::uint64_t add) { // words = words * mul + add
+		for(auto& word : words) { // add < 2^32 and word * mul <= (2^32 - 1)^2, so add can't overflow
+			add += word * mul;
+			word = static_cast<std::uint32_t>(add);
+			add >>= 32;
+		}
+		assert(add == 0);
+	};
+	for(std::size_t idx = 0; idx != res.size(); ++idx) {
+		if(idx < ntt_size) {
+			const std::uint64_t t1 = r1[idx],
+			                    t2 = (r2[idx] + p2 - t1 % p2) % p2 * p1_inv_p2 % p2,
+			                    t3 = ((r3[idx] + p3 - t1 % p3) % p3 * p1_inv_p3 % p3 + p3 - t2) % p3 * p2_inv_p3 % p3;
+			std::array<std::uint32_t, 4> x{ static_cast<std::uint32_t>(t3) };
+			mul_add(x, p2, t2);
+			mul_add(x, p1, t1);
+			std::uint64_t n = 0;
+			for(std::size_t word = 0; word != carry.size(); ++word) { // carry += x
+				n += static_cast<std::uint64_t>(carry[word]) + x[word];
+				carry[word] = static_cast<std::uint32_t>(n);
+				n >>= 32;
+			}
+			assert(n == 0);
+		}
+		if constexpr(base == 0) { // Specialisation: bigit is the lowest word
+			res[idx] = carry.front();
+			std::ranges::copy(carry | __DROP1_V, carry.begin());
+			carry.back() = 0;
+		} else { // carry /= B, keeping the remainder as the bigit
+			std::uint64_t r = 0;
+			for(auto& word : carry | __REV_V) {
+				r = (r << 32) | word;
+				word = r / true_base();
+				r %= true_base();
+			}
+			res[idx] = r;
+		}
+	}
+	assert(std::ranges::all_of(carry, [](const auto word) { return word == 0; }));
+}
+
+template<std::uint32_t base, typename Allocator>
+template<std::uint32_t mod, std::uint32_t root>
+constexpr void BigInt<base, Allocator>::__ntt_convolve(std::span<std::uint32_t> res, std::span<const std::uint32_t> a_bi, std::span<const std::uint32_t> b_bi, std::span<std::uint32_t> scratch)
+{ // res = a_bi * b_bi as polynomials, with each coefficient reduced modulo mod. res.size() must be a power of 2 at least a_bi.size() + b_bi.size() - 1.
+  // b_bi's transform, then the twiddles, are taken from scratch, which must have 3 * res.size() bigits
+	assert(std::has_single_bit(res.size()) && res.size() >= a_bi.size() + b_bi.size() - 1 && scratch.size() >= 3 * res.size());
+	const auto b_vals = scratch.first(res.size()), ntt_scratch = scratch.subspan(res.size());
+	std::ranges::fill(res, 0);
+	std::ranges::transform(a_bi, res.begin(), [](const std::uint32_t bigit) { return bigit % mod; });
+	__ntt<mod, root>(res, false, ntt_scratch);
+
+	if(a_bi.data() == b_bi.data() && a_bi.size() == b_bi.size()) // Squaring: only one forward transform needed
+		for(auto& val : res)
+			val = static_cast<std::uint64_t>(val) * val % mod;
+	else {
+		std::ranges::fill(b_vals, 0);
+		std::ranges::transform(b_bi, b_vals.begin(), [](const std::uint32_t bigit) { return bigit % mod; });
+		__ntt<mod, root>(b_vals, false, ntt_scratch);
+		for(std::size_t idx = 0; idx != res.size(); ++idx) // Pointwise multiplication
+			res[idx] = static_cast<std::uint64_t>(res[idx]) * b_vals[idx] % mod;
+	}
+	__ntt<mod, root>(res, true, ntt_scratch);
+}
+
+template<std::uint32_t base, typename Allocator>
+template<std::uint32_t mod, std::uint32_t root>
+constexpr void BigInt<base, Allocator>::__ntt(std::span<std::uint32_t> vals, const bool inverse, std::span<std::uint32_t> scratch)
+{ // In-place iterative radix-2 number-theoretic transform modulo mod, where root is a primitive root of mod: O(N log N).
+  // The twiddles are kept in scratch, which must have 2 * (vals.size() - 1) bigits
+	const auto size = vals.size();
+	assert(std::has_single_bit(size) && (mod - 1) % size == 0 && scratch.size() >= 2 * (size - 1));
+	if(size == 1)
+		return;
+
+	for(std::size_t idx = 1, rev_idx = 0; idx != size; ++idx) { // Bit-reversal permutation
+		auto bit = size >> 1;
+		for(; rev_idx & bit; bit >>= 1)
+			rev_idx ^= bit;
+		rev_idx ^= bit;
+		if(idx < rev_idx)
+			std::swap(vals[idx], vals[rev_idx]);
+	}
+
+	// Powers of the primitive len-th roots of unity for every len, stored contiguously from len = 2 at index 0.
+	// Each is paired with floor(twiddle * 2^32 / mod), so products can be reduced without division (Shoup's method)
+	const auto twiddles = scratch.first(size - 1), twiddles_shoup = scratch.subspan(size - 1, size - 1);
+	const std::uint64_t unity_root = __pow_mod(inverse ? __pow_mod(root, mod - 2, mod) : root, (mod - 1) / size, mod);
+	const auto top = twiddles.subspan((size >> 1) - 1);
+	top[0] = 1;
+	for(std::size_t idx = 1; idx != top.size(); ++idx)
+		top[idx] = top[idx - 1] * unity_root % mod;
+	for(std::size_t half = (size >> 2); half; half >>= 1) // Every smaller len uses every other power of the next len's root
+		for(std::size_t idx = 0; idx != half; ++idx)
+			twiddles[half - 1 + idx] = twiddles[2 * half - 1 + 2 * idx];
+	for(std::size_t idx = 0; idx != twiddles.size(); ++idx)
+		twiddles_shoup[idx] = (static_cast<std::uint64_t>(twiddles[idx]) << 32) / mod;
+
+	for(std::size_t half = 1; half != size; half <<= 1) { // Cooley-Tukey butterflies
+		const auto* const stage_twiddles = &twiddles[half - 1];
+		const auto* const stage_twiddles_shoup = &twiddles_shoup[half - 1];
+		for(std::size_t offset = 0; offset != size; offset += 2 * half)
+			for(std::size_t idx = 0; idx != half; ++idx) {
+				const std::uint64_t u = vals[offset + idx],
+				                    x = vals[offset + idx + half],
+				                    q = (x * stage_twiddles_shoup[idx]) >> 32;
+				auto v = x * stage_twiddles[idx] - q * mod; // In [0, 2 * mod)
+				if(v >= mod)
+					v -= mod;
+				vals[offset + idx] = u + v < mod ? u + v : u + v - mod;
+				vals[offset + idx + half] = u < v ? u + mod - v : u - v;
+			}
+	}
+
+	if(inverse) {
+		const std::uint64_t size_inv = __pow_mod(size, mod - 2, mod);
+		for(auto& val : vals)
+			val = val * size_inv % mod;
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__div_bigits(std::span<std::uint32_t> q_bi, std::span<std::uint32_t> u_bi, std::span<const std::uint32_t> v_bi, std::span<std::uint32_t> scratch)
+{ // q_bi = u_bi / v_bi, leaving the remainder in the low v_bi.size() bigits of u_bi, picking the algorithm by size, with every temporary taken from scratch.
+  // Requires v_bi to be normalised (top bigit at least B / 2), v_bi.size() >= 2, u_bi.size() == q_bi.size() + v_bi.size(), u_bi's top v_bi.size() bigits < v_bi
+  // and scratch.size() >= __div_scratch_size(q_bi.size(), v_bi.size())
+	const auto k = q_bi.size(), n = v_bi.size();
+	assert(scratch.size() >= __div_scratch_size(k, n));
+	if(k < __DIV_DC_THRESHOLD || n < __DIV_DC_THRESHOLD)
+		__div_bigits_long(q_bi, u_bi, v_bi);
+	else if(k >= __DIV_NEWTON_THRESHOLD && n >= __DIV_NEWTON_THRESHOLD)
+		__div_bigits_newton(q_bi, u_bi, v_bi, scratch);
+	else { // Every step and level shares scratch, for its product and that product's temporaries
+		if(k > n) // Schoolbook division with v_bi.size() bigit "digits": each step is a balanced division
+			for(auto j = k; j;) {
+				const auto chunk = std::min(n, j);
+				j -= chunk;
+				__div_bigits_dc(q_bi.subspan(j, chunk), u_bi.subspan(j, n + chunk), v_bi, scratch);
+			}
+		else
+			__div_bigits_dc(q_bi, u_bi, v_bi, scratch);
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__div_scratch_size(const std::size_t k, const std::size_t n) noexcept
+{ // Bigits of scratch __div_bigits needs to divide k + n by n bigits. Follows the same choice of algorithm, so is exact
+	if(k < __DIV_DC_THRESHOLD || n < __DIV_DC_THRESHOLD)
+		return 0;
+	else if(k >= __DIV_NEWTON_THRESHOLD && n >= __DIV_NEWTON_THRESHOLD)
+		return __div_newton_scratch_size(k, n);
+	const auto last_chunk = k > n ? k % n : 0; // Steps of n bigits, as in __div_bigits, of which the last may be shorter
+	return std::max(__div_dc_scratch_size(std::min(k, n), n), last_chunk ? __div_dc_scratch_size(last_chunk, n) : 0);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__div_bigits_long(std::span<std::uint32_t> q_bi, std::span<std::uint32_t> u_bi, std::span<const std::uint32_t> v_bi) noexcept
+{ // Knuth's Algorithm D: q_bi = u_bi / v_bi, leaving the remainder in the low v_bi.size() bigits of u_bi: O(N * M). Same requirements as __div_bigits
+	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
+	const auto n = v_bi.size();
+	assert(n >= 2 && u_bi.size() == q_bi.size() + n && v_bi.back() >= true_base() / 2 && __compare_bigits(u_bi.last(n), v_bi) == __LESS_SO);
+
+	const std::uint64_t v1 = v_bi[n - 1], v2 = v_bi[n - 2];
+	[[maybe_unused]] std::uint64_t reciprocal;
+	if constexpr(bits_per_bigit)
+		reciprocal = __reciprocal_2by1(v1);
+	for(auto j = q_bi.size(); j--;) { // Each quotient bigit from the top, estimated from the top 3 bigits of the remainder
+		const std::uint64_t u0 = u_bi[j + n], u1 = u_bi[j + n - 1], u2 = u_bi[j + n - 2];
+		assert(u0 <= v1); // The remainder so far is less than v_bi
+		std::uint64_t q_hat, r_hat;
+		if(u0 == v1) { // (u0 * B + u1) / v1 >= B, so start from B - 1
+			q_hat = true_base() - 1;
+			r_hat = u1 + v1;
+		} else if constexpr(bits_per_bigit) // Specialisation: no hardware division
+			q_hat = __div_2by1(u0, u1, v1, reciprocal, r_hat);
+		else { // u0 * B + u1 < B^2 fits in a uint64_t
+			const auto u01 = u0 * true_base() + u1;
+			q_hat = u01 / v1;
+			r_hat = u01 % v1;
+		}
+		while(r_hat < true_base() && q_hat * v2 > r_hat * true_base() + u2) { // Leaves q_hat at most 1 too large
+			--q_hat;
+			r_hat += v1;
+		}
+
+		std::uint64_t carry = 0, borrow = 0;
+		for(std::size_t idx = 0; idx != n; ++idx) { // u_bi[j...j + n] -= q_hat * v_bi
+			carry += q_hat * v_bi[idx];
+			if constexpr(bits_per_bigit) { // Specialisation: masks and shifts
+				borrow = u_bi[j + idx] - (carry & (true_base() - 1)) - borrow;
+				u_bi[j + idx] = borrow & (true_base() - 1);
+				carry >>= bits_per_bigit;
+				borrow >>= 63; // Top bit is set only if the difference wrapped
+			} else {
+				const auto sub = carry % true_base() + borrow;
+				borrow = u_bi[j + idx] < sub;
+				u_bi[j + idx] += borrow * true_base() - sub;
+				carry /= true_base();
+			}
+		}
+		const auto top_sub = carry + borrow;
+		borrow = u_bi[j + n] < top_sub;
+		u_bi[j + n] += borrow * true_base() - top_sub;
+		if(borrow) { // q_hat was 1 too large, which is rare: add v_bi back, dropping the carry
+			--q_hat;
+			__add_bigits(u_bi.subspan(j, n + 1), v_bi);
+		}
+		assert(u_bi[j + n] == 0);
+		q_bi[j] = q_hat;
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__div_bigits_dc(std::span<std::uint32_t> q_bi, std::span<std::uint32_t> u_bi, std::span<const std::uint32_t> v_bi, std::span<std::uint32_t> scratch)
+{ // Burnikel and Ziegler's recursive division: q_bi = u_bi / v_bi, leaving the remainder in the low v_bi.size() bigits of u_bi.
+  // Same requirements as __div_bigits, q_bi.size() <= v_bi.size() and scratch.size() >= __div_dc_scratch_size(q_bi.size(), v_bi.size()).
+  // Costs O(M(N) log N), where M(N) is the cost of multiplication
+	static_assert(__DIV_DC_THRESHOLD >= 2);
+	const auto k = q_bi.size(), n = v_bi.size();
+	assert(k <= n && u_bi.size() == k + n && scratch.size() >= __div_dc_scratch_size(k, n));
+	if(k < __DIV_DC_THRESHOLD)
+		return __div_bigits_long(q_bi, u_bi, v_bi);
+
+	if(2 * k > n) { // Divide 2N by N bigits as two 3N / 2 by N bigit divisions: the top half of the quotient, then the bottom half
+		const auto lo = k / 2;
+		__div_bigits_dc(q_bi.subspan(lo), u_bi.subspan(lo), v_bi, scratch);
+		__div_bigits_dc(q_bi.first(lo), u_bi.first(n + lo), v_bi, scratch);
+		return;
+	}
+
+	// Divide N + K by N bigits: estimate q_bi by dividing u_bi's top 2K bigits by v_bi's top K bigits, then correct it using the rest of v_bi
+	const auto v_hi = v_bi.last(k), v_lo = v_bi.first(n - k);
+	const auto u_top = u_bi.subspan(n - k);
+	if(__compare_bigits(u_bi.last(k), v_hi) == __LESS_SO)
+		__div_bigits_dc(q_bi, u_top, v_hi, scratch); // Leaves the remainder in u_top's low K bigits
+	else { // Estimate would be B^K or more, so use B^K - 1: the remainder is then u_top - (B^K - 1) * v_hi = u_top - B^K * v_hi + v_hi
+		std::ranges::fill(q_bi, true_base() - 1);
+		__sub_bigits(u_bi.last(k), v_hi);
+		__add_bigits(u_top, v_hi);
+	}
+
+	const auto prod = scratch.first(n); // Recursion is over, so the product can have scratch
+	__mul_bigits(prod, q_bi, v_lo, scratch.subspan(n)); // q_bi is no longer than v_lo, as 2K <= N
+	auto borrow = __sub_bigits(u_bi, prod);
+	while(borrow) { // Estimate is at most 2 too large, since v_bi is normalised
+		const std::array<std::uint32_t, 1> one{ 1 };
+		__sub_bigits(q_bi, one);
+		borrow -= __add_bigits(u_bi, v_bi);
+	}
+	assert(std::ranges::all_of(u_bi.last(k), [](const std::uint32_t bigit) { return bigit == 0; }));
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__div_dc_scratch_size(const std::size_t k, const std::size_t n) noexcept
+{ // Bigits of scratch for __div_bigits_dc to divide k + n by n bigits: each step's product, then that product's scratch
+	if(k < __DIV_DC_THRESHOLD)
+		return 0;
+	else if(2 * k > n)
+		return std::max(__div_dc_scratch_size(k - k / 2, n), __div_dc_scratch_size(k / 2, n));
+	return std::max(__div_dc_scratch_size(k, k), n + __mul_scratch_size(k, n - k));
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__div_bigits_newton(std::span<std::uint32_t> q_bi, std::span<std::uint32_t> u_bi, std::span<const std::uint32_t> v_bi, std::span<std::uint32_t> scratch)
+{ // q_bi = u_bi / v_bi, leaving the remainder in the low v_bi.size() bigits of u_bi, by multiplying by a Newton iteration reciprocal of v_bi: O(M(N)).
+  // Same requirements as __div_bigits, with scratch.size() >= __div_newton_scratch_size(q_bi.size(), v_bi.size())
+	const auto k = q_bi.size(), n = v_bi.size();
+	assert(scratch.size() >= __div_newton_scratch_size(k, n));
+	const auto m = std::min(k, n); // Only v_bi's top m bigits are needed to estimate m quotient bigits at a time
+	const auto v_top = v_bi.last(m);
+	const auto reciprocal = scratch.first(m + 1), rest = scratch.subspan(m + 1);
+	__reciprocal_bigits(reciprocal, v_top, rest);
+
+	for(auto j = k; j;) { // Schoolbook division with m bigit "digits", as in __div_bigits
+		const auto chunk = std::min(m, j);
+		j -= chunk;
+		const auto u_chunk = u_bi.subspan(j, n + chunk);
+		const auto q_chunk = q_bi.subspan(j, chunk);
+
+		// q_chunk is about u_chunk's top chunk + m bigits * reciprocal / B^2m, which may be slightly too large or small.
+		// Only the top chunk + 1 of those bigits are needed: the rest change the estimate by less than 1
+		const auto prod = rest.first(chunk + m + 2);
+		__mul_bigits(prod, u_chunk.last(chunk + 1), reciprocal, rest.subspan(prod.size())); // chunk <= m
+		const auto q_est = prod.subspan(m + 1);
+		if(q_est.back() == 0)
+			std::ranges::copy(q_est.first(chunk), q_chunk.begin());
+		else // The quotient can't be B^chunk or more
+			std::ranges::fill(q_chunk, true_base() - 1);
+
+		const auto q_prod = rest.first(chunk + n);
+		__mul_bigits(q_prod, q_chunk, v_bi, rest.subspan(q_prod.size()));
+		auto borrow = __sub_bigits(u_chunk, q_prod);
+		const std::array<std::uint32_t, 1> one{ 1 };
+		while(borrow) { // Estimate was too large
+			__sub_bigits(q_chunk, one);
+			borrow -= __add_bigits(u_chunk, v_bi);
+		}
+		while(__compare_bigits(u_chunk, v_bi) != __LESS_SO) { // Estimate was too small
+			__add_bigits(q_chunk, one);
+			__sub_bigits(u_chunk, v_bi);
+		}
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__reciprocal_bigits(std::span<std::uint32_t> res, std::span<const std::uint32_t> v_bi, std::span<std::uint32_t> scratch)
+{ // res is about (B^2N - 1) / v_bi, within a few units, by Newton iteration: X' = X + X * (B^2N - v_bi * X) / B^2N, doubling the precision of X each step.
+  // Requires v_bi to be normalised, res.size() == v_bi.size() + 1 and scratch.size() >= __reciprocal_scratch_size(v_bi.size()).
+  // Costs about 3 multiplications of N bigits
+	static_assert(__DIV_NEWTON_THRESHOLD >= 3); // So h < m below
+	const auto m = v_bi.size();
+	assert(res.size() == m + 1 && v_bi.back() >= true_base() / 2 && scratch.size() >= __reciprocal_scratch_size(m));
+	if(m < __DIV_NEWTON_THRESHOLD) { // Exactly, by division
+		const auto u_bi = scratch.first(2 * m + 1);
+		std::ranges::fill(u_bi, true_base() - 1);
+		u_bi.back() = 0;
+		return __div_bigits(res, u_bi, v_bi, scratch.subspan(u_bi.size()));
+	}
+
+	// Start from the reciprocal X_h of v_bi's top h bigits, which is accurate to about h bigits
+	const auto h = m / 2 + 1;
+	const auto res_h = scratch.first(h + 1), rest = scratch.subspan(h + 1);
+	__reciprocal_bigits(res_h, v_bi.last(h), rest);
+
+	// Scaled down to X_h's precision, the error term is D = B^(m + h) - v_bi * X_h, which has about m bigits
+	auto diff = rest.first(m + h + 1);
+	const auto power = rest.subspan(diff.size(), m + h + 1), prod_scratch = rest.subspan(2 * diff.size());
+	__mul_bigits(diff, res_h, v_bi, prod_scratch); // res_h is no longer than v_bi
+	std::ranges::fill(power, 0);
+	power.back() = 1;
+	const auto negative_diff = __compare_bigits(diff, power) == __GREATER_SO;
+	if(negative_diff)
+		__sub_bigits(diff, power);
+	else {
+		__sub_bigits(power, diff);
+		diff = power;
+	}
+
+	// X = X_h * B^(m - h) +- X_h * D / B^2h, where only D's top bigits affect the result. Those are trimmed, unless that product would need more
+	// scratch than the untrimmed one, which scratch is sized for
+	std::span<const std::uint32_t> diff_top = diff.subspan(h - 1);
+	const auto trimmed = __trim_bigits(diff_top);
+	if(h + 1 + trimmed.size() + __mul_scratch_size(std::min(h + 1, trimmed.size()), std::max(h + 1, trimmed.size())) <= prod_scratch.size())
+		diff_top = trimmed;
+	const auto correction = prod_scratch.first(h + 1 + diff_top.size()), correction_scratch = prod_scratch.subspan(correction.size());
+	if(diff_top.size() < res_h.size())
+		__mul_bigits(correction, diff_top, res_h, correction_scratch);
+	else
+		__mul_bigits(correction, res_h, diff_top, correction_scratch);
+	const auto correction_top = __trim_bigits(correction.subspan(h + 1));
+	std::ranges::fill(res, 0);
+	std::ranges::copy(res_h, res.begin() + (m - h));
+	if(negative_diff)
+		__sub_bigits(res, correction_top);
+	else if(__add_bigits(res, correction_top)) // Can't be 2 * B^m or more
+		std::ranges::fill(res, true_base() - 1);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__div_newton_scratch_size(const std::size_t k, const std::size_t n) noexcept
+{ // Bigits of scratch for __div_bigits_newton: the reciprocal, then either its own scratch, or each step's products and their scratch
+	const auto m = std::min(k, n);
+	const auto step = [m, n](const std::size_t chunk) {
+		return std::max(chunk + m + 2 + __mul_scratch_size(chunk + 1, m + 1), chunk + n + __mul_scratch_size(chunk, n));
+	};
+	return m + 1 + std::max({ __reciprocal_scratch_size(m), step(m), k % m ? step(k % m) : 0 });
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__reciprocal_scratch_size(const std::size_t m) noexcept
+{ // Bigits of scratch for __reciprocal_bigits of m bigits. At the bottom, the dividend and its division's scratch. Above it, X_h, then either its
+  // own scratch, or the error term, B^(m + h) and the products' scratch
+	if(m < __DIV_NEWTON_THRESHOLD)
+		return 2 * m + 1 + __div_scratch_size(m + 1, m);
+	const auto h = m / 2 + 1;
+	return h + 1 + std::max(__reciprocal_scratch_size(h), 2 * (m + h + 1) + std::max(__mul_scratch_size(h + 1, m), m + h + 3 + __mul_scratch_size(h + 1, m + 2)));
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__mul_eq_signless(const BigInt<base, Allocator>& other)
 {
-	std::vector<std::uint32_t> prod_bigits;
-	prod_bigits.reserve(size() + other.size()); // Know we will be using at most size() + other.size()
-	prod_bigits.resize(prod_bigits.capacity() - 1, 0); // Know we will be using at least size() + other.size() - 1
+	BigitVector<Allocator> prod_bigits(get_allocator()), scratch(get_allocator());
+	return __mul_eq_signless(other, prod_bigits, scratch);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__mul_eq_signless(const BigInt<base, Allocator>& other, BigitVector<Allocator>& prod_bigits, BigitVector<Allocator>& scratch)
+{ // The product is built in prod_bigits, which then swaps with bigits, and its temporaries are taken from scratch, which only ever grows. Passing
+  // the same prod_bigits and scratch to a series of products reuses their storage. Both must have the same allocator as *this
+	prod_bigits.assign(size() + other.size(), 0); // Know we will be using at most size() + other.size()
 
 	const auto& a_bi = size() < other.size() ? bigits : other.bigits;
 	const auto& b_bi = size() < other.size() ? other.bigits : bigits; // a_bi is smaller than b_bi
+	scratch.resize(std::max(scratch.size(), __mul_scratch_size(a_bi.size(), b_bi.size())));
+	__mul_bigits(prod_bigits, a_bi, b_bi, scratch);
 
-	std::uint64_t a, b, n = 0;
-	for(std::size_t b_idx, a_idx = 0; a_idx != a_bi.size(); ++a_idx) { // Standard long multiplication method: O(N^2)
-		a = a_bi[a_idx];
-		for(b_idx = 0; b_idx < b_bi.size() || n; ++b_idx) {
-			b = b_idx < b_bi.size() ? b_bi[b_idx] : 0;
-			n += a * b;
-			const auto idx = a_idx + b_idx;
-			const auto under_size = idx < prod_bigits.size();
-			if(under_size)
-				n += prod_bigits[idx];
-			const auto val = n % true_base();
-			if(under_size)
-				prod_bigits[idx] = val;
-			else
-				prod_bigits.push_back(val);
-			n /= true_base();
+	if(prod_bigits.back() == 0) // Can only possibly be 1 bigit too large
+		prod_bigits.pop_back();
+	bigits.swap(prod_bigits);
+	assert(valid());
+	return *this;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__sqr_eq_signless()
+{
+	BigitVector<Allocator> prod_bigits(get_allocator()), scratch(get_allocator());
+	return __sqr_eq_signless(prod_bigits, scratch);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__sqr_eq_signless(BigitVector<Allocator>& prod_bigits, BigitVector<Allocator>& scratch)
+{ // As __mul_eq_signless
+	prod_bigits.assign(2 * size(), 0);
+	scratch.resize(std::max(scratch.size(), __mul_scratch_size(size(), size())));
+	__sqr_bigits(prod_bigits, bigits, scratch);
+
+	if(prod_bigits.back() == 0) // Can only possibly be 1 bigit too large
+		prod_bigits.pop_back();
+	bigits.swap(prod_bigits);
+	assert(valid());
+	return *this;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__mul_of(const BigInt<base, Allocator>& a, const BigInt<base, Allocator>& b)
+{ // *this = a * b, built straight into bigits, reusing their storage. Requires *this to be neither a nor b
+	assert(this != &a && this != &b);
+	if(a.is_zero() || b.is_zero())
+		return *this = 0;
+	bigits.assign(a.size() + b.size(), 0);
+
+	const auto& a_bi = a.size() < b.size() ? a.bigits : b.bigits;
+	const auto& b_bi = a.size() < b.size() ? b.bigits : a.bigits; // a_bi is smaller than b_bi
+	BigitVector<Allocator> scratch(__mul_scratch_size(a_bi.size(), b_bi.size()), 0, get_allocator());
+	__mul_bigits(bigits, a_bi, b_bi, scratch); // Squares if a and b are the same
+
+	if(bigits.back() == 0) // Can only possibly be 1 bigit too large
+		bigits.pop_back();
+	negative = a.negative != b.negative;
+	assert(valid());
+	return *this;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__addmul_eq(const BigInt<base, Allocator>& a, const BigInt<base, Allocator>& b, const bool subtract)
+{ // *this += a * b, or *this -= a * b if subtract. Requires *this to be neither a nor b. Short products are accumulated into bigits a row at a
+  // time, so are never built. Longer ones are built beside them, as the multiplication algorithms need
+	assert(this != &a && this != &b);
+	if(a.is_zero() || b.is_zero())
+		return *this;
+	const auto prod_negative = (a.negative != b.negative) != subtract;
+	if(is_zero()) {
+		__mul_of(a, b);
+		negative = prod_negative;
+		return *this;
+	}
+
+	const auto& a_bi = a.size() < b.size() ? a.bigits : b.bigits;
+	const auto& b_bi = a.size() < b.size() ? b.bigits : a.bigits; // a_bi is smaller than b_bi
+	if(a_bi.size() >= __KARATSUBA_THRESHOLD) {
+		BigInt prod(get_allocator());
+		prod.__mul_of(a, b);
+		prod.negative = prod_negative;
+		return *this += prod;
+	}
+
+	if(negative == prod_negative) { // Magnitudes add
+		resize(std::max(size(), a_bi.size() + b_bi.size()) + 1, 0);
+		__addmul_bigits_long(bigits, a_bi, b_bi);
+	} else {
+		resize(std::max(size(), a_bi.size() + b_bi.size()), 0);
+		if(__submul_bigits_long(bigits, a_bi, b_bi)) { // The product was larger, so bigits hold B^size() - |result|: negate them back
+			__negate_bigits(bigits);
+			negative = prod_negative;
 		}
 	}
 
-	bigits = std::move(prod_bigits);
+	while(back() == 0 && size() != 1) // Chop off leading zeros
+		bigits.pop_back();
 	assert(valid());
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__mul_eq_signless(const std::uint64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__mulmod_of(const BigInt<base, Allocator>& a, const BigInt<base, Allocator>& b, const std::int64_t mod)
+{ // *this = (a * b) % mod, with the sign operator% gives. Requires *this to be neither a nor b. A modulus of at most B reduces a and b first, so
+  // their product is never built: O(N)
+	if(mod == 0)
+		throw std::domain_error(__THROW_DIVIDE_ZERO_DOMAIN);
+	const auto mod_abs = __constexpr_abs(mod);
+	if(mod_abs > true_base() || (a.size() == 1 && b.size() == 1)) { // The product may be smaller than mod, which % leaves as it is, sign and all
+		__mul_of(a, b);
+		return *this %= mod;
+	}
+
+	const auto residue = [mod_abs](const BigInt& bi) {
+		std::uint64_t rem = 0;
+		for(const auto bigit : bi.bigits | __REV_V) // Can't overflow: (mod_abs - 1)B + B - 1 < B^2
+			rem = (rem * true_base() + bigit) % mod_abs;
+		return rem;
+	};
+	return *this = static_cast<std::int64_t>(residue(a) * residue(b) % mod_abs);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__mul_eq_signless(const std::uint64_t other)
 {
 	const auto bigit_shl_count = __int_log_of(other, true_base());
 	if(bigit_shl_count) { // Skip calculations and shift all bigits left: O(N)
 		bigits.insert(bigits.begin(), bigit_shl_count, 0);
 		assert(valid());
 		return *this;
-	} else if(other > true_base()) // other < true_base() required for specialisation
-		return __mul_eq_signless(make_big_int<base>(other));
-
-	reserve(size() + 1);
-
-	std::uint64_t n = 0;
-	for(auto& a : bigits) { // Specialisation: standard (short) multiplication method: O(N)
-		n += other * a;
-		a = n % true_base();
-		n /= true_base();
-	}
-	if(n) {
-		assert(n < true_base() - 1);
-		bigits.push_back(n);
+	} else if(base != MAX_BASE && other > true_base()) // other < true_base() required for specialisation
+		return __mul_eq_signless(make_big_int<base, Allocator>(other, get_allocator()));
+
+	if constexpr(base == MAX_BASE) { // Specialisation: any 64 bit other, with 64x64 -> 128 bit products: O(N)
+		std::uint64_t carry = 0, high;
+		for(auto& a : bigits) { // Can't overflow: (2^64 - 1)(2^32 - 1) + (2^64 - 1) < 2^96
+			auto low = __mul_wide(other, a, high);
+			low += carry;
+			high += low < carry;
+			a = static_cast<std::uint32_t>(low);
+			carry = (low >> 32) | (high << 32);
+		}
+		for(; carry; carry >>= 32)
+			bigits.push_back(static_cast<std::uint32_t>(carry));
+	} else {
+		std::uint64_t n = 0;
+		for(auto& a : bigits) { // Specialisation: standard (short) multiplication method: O(N)
+			n += other * a;
+			a = n % true_base();
+			n /= true_base();
+		}
+		if(n) {
+			assert(n < true_base() - 1);
+			bigits.push_back(n);
+		}
 	}
 
 	assert(valid());
 	return *this;
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<bool remainder> // If true, acts as mod (%), otherwise acts as div (/)
-constexpr BigInt<base>& BigInt<base>::__div_mod_eq_signless(const BigInt<base>& other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__div_mod_eq_signless(const BigInt<base, Allocator>& other)
 {
+	BigInt<base, Allocator> rem(get_allocator());
+	__div_rem_eq_signless(other, rem);
+	if constexpr(remainder) {
+		bigits.swap(rem.bigits);
+		negative = false;
+	}
+
+	assert(valid());
+	return *this;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__div_rem_eq_signless(const BigInt<base, Allocator>& other, BigInt<base, Allocator>& rem)
+{ // Sets *this to |*this| / |other| and rem to |*this| % |other| in a single division. Keeps the sign of *this, rem is made positive
+	assert(!other.is_zero() && &rem != this);
 	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
-	if constexpr(bits_per_bigit) { // Specialisation: binary long division method with remainder: O(N)
-		BigInt<base> r; // *this can be used as q, since only one bit is updated at a time
-		[[maybe_unused]] std::size_t used_idx = 0;
-
-		auto bit = bits();
-		auto* q_bigit = &bigits[bit / bits_per_bigit];
-		std::uint32_t single_bit = 1u << (bit % bits_per_bigit);
-		do {
-			if(single_bit & 1u) {
-				--q_bigit;
-				single_bit = 1u << (bits_per_bigit - 1);
-			} else
-				single_bit >>= 1;
-			const bool bit_set = *q_bigit & single_bit;
-
-			r <<= 1;
-			if(bit_set)
-				r |= 1u;
-			if constexpr(remainder) {
-				if(r.__compare_signless(other) != __LESS_SO) // Treat other as if it's positive
-					r.__sub_eq_signless(other);
-			} else {
-				if(r.__compare_signless(other) != __LESS_SO) { // ...
-					r.__sub_eq_signless(other);
-					if(!bit_set)
-						*q_bigit |= single_bit; // Set bit
-					if(!used_idx)
-						used_idx = bit;
-				} else if(bit_set)
-					*q_bigit ^= single_bit; // Unset bit
-			}
-		} while(--bit);
+	if(__compare_signless(other) == __LESS_SO) {
+		rem.bigits.assign(bigits.begin(), bigits.end());
+		rem.negative = false;
+		bigits.assign(1, 0);
+		return *this;
+	} else if(other.size() == 1) { // Specialisation: short division, no base conversion required
+		std::uint64_t r;
+		__div_rem_eq_signless(static_cast<std::uint64_t>(other.front()), r);
+		rem.bigits.assign(1, static_cast<std::uint32_t>(r));
+		rem.negative = false;
+		return *this;
+	}
 
-		if constexpr(remainder)
-			*this = r;
-		else
-			resize((used_idx / bits_per_bigit) + 1);
-	} else { // Convert to a binary base, then re-call, then convert base back: O(N^2)
-		BigInt<MAX_BASE> this_bin_base{ clone() }, other_bin_base{ other.clone() };
-		return *this = this_bin_base.template __div_mod_eq_signless<remainder>(other_bin_base);
+	// Knuth's Algorithm D, word-level long division in radix true_base(): O(N * M), or less for large operands (see __div_bigits).
+	// Normalise first, so that other's top bigit is at least B / 2: by a bit shift for binary bases, otherwise by a small factor
+	// The normalised divisor and the division's temporaries share one block, allocated like bigits. The dividend gains a bigit in normalising
+	std::uint8_t shift = 0;
+	std::uint32_t scale = 1;
+	const auto n = other.size();
+	BigitVector<Allocator> work(n + __div_scratch_size(size() + 1 - n, n), 0, get_allocator());
+	const auto v_bi = std::span(work).first(n);
+	if constexpr(bits_per_bigit) {
+		shift = bits_per_bigit - std::bit_width(other.back());
+		__shl_bigits(v_bi, other.bigits, shift);
+		bigits.push_back(0);
+		const auto u_bi = std::span(bigits).first(size() - 1);
+		bigits.back() = __shl_bigits(u_bi, u_bi, shift);
+	} else {
+		scale = true_base() / (other.back() + 1ull);
+		std::ranges::copy(other.bigits, v_bi.begin());
+		const auto u_size = size();
+		if(scale != 1) {
+			__mul_bigits_small(v_bi, scale); // Can't carry out: other.back() * scale < B
+			bigits.push_back(__mul_bigits_small(bigits, scale));
+		} else
+			bigits.push_back(0);
+		assert(size() == u_size + 1);
 	}
 
-	assert(valid());
+	BigitVector<Allocator> q_bi(size() - n, 0, get_allocator());
+	__div_bigits(q_bi, bigits, v_bi, std::span(work).subspan(n));
+	rem.bigits.assign(bigits.begin(), std::next(bigits.begin(), v_bi.size())); // Remainder is left in the low bigits, still normalised
+	if constexpr(bits_per_bigit)
+		__shr_bigits(rem.bigits, shift);
+	else if(scale != 1)
+		__div_bigits_small(rem.bigits, scale);
+	rem.negative = false;
+	while(rem.back() == 0 && rem.size() != 1)
+		rem.bigits.pop_back();
+	bigits = std::move(q_bi);
+	while(back() == 0 && size() != 1)
+		bigits.pop_back();
+
+	assert(valid() && rem.valid());
 	return *this;
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<bool remainder> // If true, acts as mod (%), otherwise acts as div (/)
-constexpr BigInt<base>& BigInt<base>::__div_mod_eq_signless(const std::uint64_t other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__div_mod_eq_signless(const std::uint64_t other)
 {
 	const auto bigit_shr_count = __int_log_of(other, true_base());
-	if(bigit_shr_count) { // Skip calculations and shift all bigits right: O(N)
-		if(size() > bigit_shr_count)
+	if(bigit_shr_count) { // Skip calculations: the quotient is all but the low bigits, the remainder is those low bigits: O(N)
+		if constexpr(remainder) {
+			if(size() > bigit_shr_count)
+				resize(bigit_shr_count);
+			while(back() == 0 && size() != 1) // Chop off leading zeros
+				bigits.pop_back();
+			negative = false;
+		} else if(size() > bigit_shr_count)
 			bigits.erase(bigits.begin(), std::next(bigits.begin(), bigit_shr_count));
 		else {
 			resize(1);
@@ -396,7 +1887,7 @@ constexpr BigInt<base>& BigInt<base>::__div_mod_eq_signless(const std::uint64_t
 		assert(valid());
 		return *this;
 	} else if(other > true_base()) // TODO confirm: other < true_base() required for specialisation
-		return __div_mod_eq_signless<remainder>(make_big_int<base>(other));
+		return __div_mod_eq_signless<remainder>(make_big_int<base, Allocator>(other, get_allocator()));
 
 	if constexpr(remainder) {
 		if(other == 2 && !(base & 1u)) { // Specialisation: % 2 is same as & 1, can do a shortcut since it's commonly used: O(1)
@@ -432,8 +1923,29 @@ constexpr BigInt<base>& BigInt<base>::__div_mod_eq_signless(const std::uint64_t
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__div_rem_eq_signless(const std::uint64_t other, std::uint64_t& rem)
+{ // Short division keeping both results: O(N)
+	assert(other);
+	if(other > true_base()) { // other <= true_base() required for specialisation
+		BigInt<base, Allocator> rem_bi(get_allocator());
+		__div_rem_eq_signless(make_big_int<base, Allocator>(other, get_allocator()), rem_bi);
+		rem = 0;
+		for(const auto& bigit : rem_bi.bigits | __REV_V)
+			rem = rem * true_base() + bigit;
+		return *this;
+	}
+
+	rem = __div_bigits_small(bigits, other);
+	while(back() == 0 && size() != 1)
+		bigits.pop_back();
+
+	assert(valid());
+	return *this;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__shl_eq_signless(const BigInt<base, Allocator>& other)
 {
 	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
 	constexpr std::uint8_t unused_bits_per_bigit = std::numeric_limits<std::uint32_t>::digits - bits_per_bigit;
@@ -443,7 +1955,7 @@ constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const BigInt<base>& othe
 	const std::uint8_t shift_bits = __constexpr_abs((other % bits_per_bigit).to_int());
 	const auto unshift_bits = bits_per_bigit - shift_bits;
 	const auto old_size = size();
-	const auto last_bigit = back() >> (bits_per_bigit - shift_bits);
+	const auto last_bigit = static_cast<std::uint32_t>(std::uint64_t{ back() } >> (bits_per_bigit - shift_bits)); // Shifts may be by 32 bits
 	resize(old_size + shift_bigits + (last_bigit != 0)); // New size must be size_t, so this can't work for all BigInts
 
 	if(last_bigit)
@@ -452,7 +1964,7 @@ constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const BigInt<base>& othe
 		auto& bigit = bigits[idx + shift_bigits];
 		bigit = bigits[idx] << (unused_bits_per_bigit + shift_bits);
 		bigit >>= unused_bits_per_bigit;
-		bigit |= bigits[idx - 1] >> unshift_bits;
+		bigit |= static_cast<std::uint32_t>(std::uint64_t{ bigits[idx - 1] } >> unshift_bits);
 	}
 	bigits[shift_bigits] = static_cast<std::uint32_t>(front() << (unused_bits_per_bigit + shift_bits)) >> unused_bits_per_bigit; // Last has no carry from next
 	while(shift_bigits)
@@ -462,8 +1974,8 @@ constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const BigInt<base>& othe
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const std::uint64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__shl_eq_signless(const std::uint64_t other)
 {
 	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
 	constexpr std::uint8_t unused_bits_per_bigit = std::numeric_limits<std::uint32_t>::digits - bits_per_bigit;
@@ -473,7 +1985,7 @@ constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const std::uint64_t othe
 	const std::uint8_t shift_bits = other % bits_per_bigit;
 	const auto unshift_bits = bits_per_bigit - shift_bits;
 	const auto old_size = size();
-	const auto last_bigit = back() >> (bits_per_bigit - shift_bits);
+	const auto last_bigit = static_cast<std::uint32_t>(std::uint64_t{ back() } >> (bits_per_bigit - shift_bits)); // Shifts may be by 32 bits
 	resize(old_size + shift_bigits + (last_bigit != 0));
 
 	if(last_bigit)
@@ -482,7 +1994,7 @@ constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const std::uint64_t othe
 		auto& bigit = bigits[idx + shift_bigits];
 		bigit = bigits[idx] << (unused_bits_per_bigit + shift_bits);
 		bigit >>= unused_bits_per_bigit;
-		bigit |= bigits[idx - 1] >> unshift_bits;
+		bigit |= static_cast<std::uint32_t>(std::uint64_t{ bigits[idx - 1] } >> unshift_bits);
 	}
 	bigits[shift_bigits] = static_cast<std::uint32_t>(front() << (unused_bits_per_bigit + shift_bits)) >> unused_bits_per_bigit; // Last has no carry from next
 	while(shift_bigits)
@@ -492,8 +2004,8 @@ constexpr BigInt<base>& BigInt<base>::__shl_eq_signless(const std::uint64_t othe
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__shr_eq_signless(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__shr_eq_signless(const BigInt<base, Allocator>& other)
 {
 	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
 	constexpr std::uint8_t unused_bits_per_bigit = std::numeric_limits<std::uint32_t>::digits - bits_per_bigit;
@@ -508,7 +2020,7 @@ constexpr BigInt<base>& BigInt<base>::__shr_eq_signless(const BigInt<base>& othe
 	assert(new_size);
 
 	for(std::size_t idx = 0; idx != new_size - 1; ++idx) { // Standard linear shift: O(N)
-		auto bigit = bigits[idx + shift_bigits + 1] << (unused_bits_per_bigit + unshift_bits);
+		auto bigit = static_cast<std::uint32_t>(std::uint64_t{ bigits[idx + shift_bigits + 1] } << (unused_bits_per_bigit + unshift_bits)); // Shifts may be by 32 bits
 		bigit >>= unused_bits_per_bigit;
 		bigit |= bigits[idx + shift_bigits] >> shift_bits;
 		bigits[idx] = bigit; // Can't make bigit a reference since shift_bigits may be 0
@@ -520,8 +2032,8 @@ constexpr BigInt<base>& BigInt<base>::__shr_eq_signless(const BigInt<base>& othe
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::__shr_eq_signless(const std::uint64_t other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__shr_eq_signless(const std::uint64_t other)
 {
 	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
 	constexpr std::uint8_t unused_bits_per_bigit = std::numeric_limits<std::uint32_t>::digits - bits_per_bigit;
@@ -536,7 +2048,7 @@ constexpr BigInt<base>& BigInt<base>::__shr_eq_signless(const std::uint64_t othe
 	assert(new_size);
 
 	for(std::size_t idx = 0; idx != new_size - 1; ++idx) { // Standard linear shift: O(N)
-		auto bigit = bigits[idx + shift_bigits + 1] << (unused_bits_per_bigit + unshift_bits);
+		auto bigit = static_cast<std::uint32_t>(std::uint64_t{ bigits[idx + shift_bigits + 1] } << (unused_bits_per_bigit + unshift_bits)); // Shifts may be by 32 bits
 		bigit >>= unused_bits_per_bigit;
 		bigit |= bigits[idx + shift_bigits] >> shift_bits;
 		bigits[idx] = bigit; // Can't make bigit a reference since shift_bigits may be 0
@@ -548,23 +2060,23 @@ constexpr BigInt<base>& BigInt<base>::__shr_eq_signless(const std::uint64_t othe
 	return *this;
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<bool right>
-constexpr BigInt<base>& BigInt<base>::__shl_shr_eq_helper(const BigInt<base>& other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__shl_shr_eq_helper(const BigInt<base, Allocator>& other)
 {
 	if(is_zero() || other.is_zero())
 		return *this;
 	if constexpr(__int_log_of(true_base(), 2))
 		return right != other.positive() ? __shl_eq_signless(other) : __shr_eq_signless(other);
 	else { // Convert to a binary base, then re-call, then convert base back: O(N^2)
-		BigInt<MAX_BASE> this_bin_base{ clone() }, other_bin_base{ other.clone() };
+		BigInt<MAX_BASE, Allocator> this_bin_base{ clone() }, other_bin_base{ other.clone() };
 		return *this = this_bin_base.template __shl_shr_eq_helper<right>(other_bin_base);
 	}
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<bool right>
-constexpr BigInt<base>& BigInt<base>::__shl_shr_eq_helper(const std::int64_t other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::__shl_shr_eq_helper(const std::int64_t other)
 {
 	if(is_zero() || other == 0)
 		return *this;
@@ -572,13 +2084,13 @@ constexpr BigInt<base>& BigInt<base>::__shl_shr_eq_helper(const std::int64_t oth
 	if constexpr(__int_log_of(true_base(), 2))
 		return right != other_positive ? __shl_eq_signless(other) : __shr_eq_signless(other);
 	else { // Convert to a binary base, then re-call, then convert base back: O(N^2)
-		BigInt<MAX_BASE> this_bin_base{ clone() };
+		BigInt<MAX_BASE, Allocator> this_bin_base{ clone() };
 		return *this = this_bin_base.template __shl_shr_eq_helper<right>(other);
 	}
 }
 
-template<std::uint32_t base>
-constexpr std::strong_ordering BigInt<base>::__compare_signless(const BigInt<base>& other, const bool sign) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::strong_ordering BigInt<base, Allocator>::__compare_signless(const BigInt<base, Allocator>& other, const bool sign) const noexcept
 {
 	if(size() != other.size())
 		return sign ? size() <=> other.size() : other.size() <=> size();
@@ -591,8 +2103,8 @@ constexpr std::strong_ordering BigInt<base>::__compare_signless(const BigInt<bas
 	return sign ? front() <=> other.front() : other.front() <=> front();
 }
 
-template<std::uint32_t base>
-constexpr std::strong_ordering BigInt<base>::__compare_signless(std::uint64_t other, const bool sign) const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::strong_ordering BigInt<base, Allocator>::__compare_signless(std::uint64_t other, const bool sign) const noexcept
 {
 	const auto other_size = __int_size(other);
 	if(size() != other_size)
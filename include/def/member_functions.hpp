@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cassert>
 #include <stdexcept>
+#include <cstring>
 
 #include "../big_int.hpp"
 #include "constructors.hpp"
@@ -17,60 +18,75 @@
 #include "utility_functions.hpp"
 #include "external_functions.hpp"
 
-template<std::uint32_t base>
-constexpr std::size_t BigInt<base>::size() const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::size() const noexcept
 {
 	return bigits.size();
 }
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::positive() const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::positive() const noexcept
 {
 	return !negative;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::sign(const bool new_sign) noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::sign(const bool new_sign) noexcept
 {
 	negative = !new_sign;
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::is_zero() const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::is_zero() const noexcept
 {
 	return size() == 1 && front() == 0;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base> BigInt<base>::clone() const
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::clone() const
 {
-	return *this;
+	return BigInt<base, Allocator>(*this, get_allocator());
 }
 
-template<std::uint32_t base>
-constexpr void BigInt<base>::swap(BigInt<base>& other) noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::swap(BigInt<base, Allocator>& other) noexcept
 {
-	const auto temp{ clone() };
-	*this = other;
-	other = temp;
+	bigits.swap(other.bigits);
+	std::ranges::swap(negative, other.negative);
 }
 
-template<std::uint32_t base>
-constexpr const std::vector<std::uint32_t>& BigInt<base>::data() const noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::span<const std::uint32_t> BigInt<base, Allocator>::data() const noexcept
 {
 	return bigits;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::abs() noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr Allocator BigInt<base, Allocator>::get_allocator() const noexcept
+{
+	return bigits.get_allocator();
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::abs() noexcept
 {
 	negative = false;
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::sqrt()
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::square()
+{
+	negative = false;
+	if(is_zero() || *this == 1)
+		return *this;
+
+	return __sqr_eq_signless();
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::sqrt()
 {
 	if(!positive())
 		throw std::domain_error(__THROW_SQRT_DOMAIN);
@@ -80,93 +96,107 @@ constexpr BigInt<base>& BigInt<base>::sqrt()
 	return __sqrt_helper();
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::log(const BigInt<base>& base_val)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::log(const BigInt<base, Allocator>& base_val)
 {
 	if(!positive() || is_zero())
 		throw std::domain_error(__THROW_LOG_VALUE_DOMAIN);
 	else if(base_val <= 1)
 		throw std::domain_error(__THROW_LOG_BASE_DOMAIN);
 
-	BigInt<base> res{ 0 };
+	BigInt<base, Allocator> res{ 0 };
 	while(*this /= base_val)
 		++res;
 	return *this = res;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::log(const std::int64_t base_val)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::log(const std::int64_t base_val)
 {
 	if(!positive() || is_zero())
 		throw std::domain_error(__THROW_LOG_VALUE_DOMAIN);
 	else if(base_val <= 1)
 		throw std::domain_error(__THROW_LOG_BASE_DOMAIN);
 
-	BigInt<base> res{ 0 };
+	BigInt<base, Allocator> res{ 0 };
 	while(*this /= base_val)
 		++res;
 	return *this = res;
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::log(const T base_val)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::log(const T base_val)
 {
 	if constexpr(INT64Constructible<T>)
 		return log(static_cast<std::int64_t>(base_val));
 	else
-		return log(make_big_int<base>(base_val));
+		return log(make_big_int<base, Allocator>(base_val, get_allocator()));
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::pow(const BigInt<base>& expo)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::pow(const BigInt<base, Allocator>& expo)
 {
 	if(!expo.positive())
 		return *this = 0;
 	else if(expo.is_zero())
 		return *this = 1;
+	else if(expo.__compare_signless(std::numeric_limits<std::int64_t>::max()) != __GREATER_SO)
+		return pow(expo.to_int());
 
-	BigInt<base> res{ 1 },
+	BigInt<base, Allocator> res{ 1, get_allocator() },
 	             expo_copy{ expo };
 	while(expo_copy != 1) {
 		if(expo_copy & 1)
 			res *= *this;
-		*this *= *this;
+		square();
 		expo_copy >>= 1;
 	}
 	return *this *= res;
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::pow(std::int64_t expo)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::pow(std::int64_t expo)
 {
 	if(expo == 0)
 		return *this = 1;
 	else if(expo < 0)
 		return *this = 0;
+	negative = !positive() && (expo & 1);
+	if(size() == 1 && front() <= 1)
+		return *this;
 
-	BigInt<base> res{ 1 };
+	// res, *this and prod_bigits take turns holding each product, and every product takes its temporaries from the one scratch. With room for the
+	// largest product and the workspace of the largest squaring up front, the loop rarely allocates
+	BigInt<base, Allocator> res{ 1, get_allocator() };
+	BigitVector<Allocator> prod_bigits(get_allocator()), scratch(get_allocator());
+	if(const auto max_size = __pow_size(expo)) {
+		res.reserve(max_size);
+		reserve(max_size);
+		prod_bigits.reserve(max_size);
+		scratch.reserve(__mul_scratch_size(max_size / 2, max_size - max_size / 2));
+	}
 	while(expo != 1) {
 		if(expo & 1)
-			res *= *this;
-		*this *= *this;
+			res.__mul_eq_signless(*this, prod_bigits, scratch);
+		__sqr_eq_signless(prod_bigits, scratch);
 		expo >>= 1;
 	}
-	return *this *= res;
+	return __mul_eq_signless(res, prod_bigits, scratch);
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::pow(const T expo)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::pow(const T expo)
 {
 	if constexpr(INT64Constructible<T>)
 		return pow(static_cast<std::int64_t>(expo));
 	else
-		return pow(make_big_int<base>(expo));
+		return pow(make_big_int<base, Allocator>(expo, get_allocator()));
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::gcd(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::gcd(const BigInt<base, Allocator>& other)
 {
 	if(other.is_zero() || *this == 1)
 		return *this;
@@ -180,15 +210,15 @@ constexpr BigInt<base>& BigInt<base>::gcd(const BigInt<base>& other)
 	return __gcd_helper(other);
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::gcd(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::gcd(const T other)
 {
-	return gcd(make_big_int<base>(other));
+	return gcd(make_big_int<base, Allocator>(other, get_allocator()));
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::lcm(const BigInt<base>& other)
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::lcm(const BigInt<base, Allocator>& other)
 {
 	if(is_zero())
 		return *this;
@@ -207,15 +237,46 @@ constexpr BigInt<base>& BigInt<base>::lcm(const BigInt<base>& other)
 	return abs();
 }
 
-template<std::uint32_t base>
+template<std::uint32_t base, typename Allocator>
 template<BigIntConstructible T>
-constexpr BigInt<base>& BigInt<base>::lcm(const T other)
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::lcm(const T other)
+{
+	return lcm(make_big_int<base, Allocator>(other, get_allocator()));
+}
+
+template<std::uint32_t base, typename Allocator>
+template<DivisionType type>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::div_rem(const BigInt<base, Allocator>& other, BigInt<base, Allocator>& rem)
+{
+	if(other.is_zero())
+		throw std::domain_error(__THROW_DIVIDE_ZERO_DOMAIN);
+	assert(&rem != this);
+	if(&other == &rem) // rem is written before other's last use
+		return div_rem<type>(other.clone(), rem);
+
+	const auto this_negative = !positive(), other_negative = !other.positive();
+	__div_rem_eq_signless(other, rem);
+	const auto round_away = type == DivisionType::TRUNCATED ? false : type == DivisionType::FLOORED ? this_negative != other_negative : this_negative;
+	if(round_away && !rem.is_zero()) { // Remainder has the wrong sign: move the quotient one further from zero, so rem becomes |other| - rem
+		__add_eq_signless(1);
+		rem.__sub_eq_signless(other);
+	}
+
+	const auto rem_negative = type == DivisionType::TRUNCATED ? this_negative : type == DivisionType::FLOORED && other_negative;
+	negative = this_negative != other_negative && !is_zero(); // Prevent -0
+	rem.negative = rem_negative && !rem.is_zero();
+	return *this;
+}
+
+template<std::uint32_t base, typename Allocator>
+template<DivisionType type, BigIntConstructible T>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::div_rem(const T other, BigInt<base, Allocator>& rem)
 {
-	return lcm(make_big_int<base>(other));
+	return div_rem<type>(make_big_int<base, Allocator>(other, get_allocator()), rem);
 }
 
-template<std::uint32_t base>
-constexpr BigInt<base>& BigInt<base>::factorial()
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator>& BigInt<base, Allocator>::factorial()
 {
 	if(is_zero())
 		return *this = 1;
@@ -226,6 +287,7 @@ constexpr BigInt<base>& BigInt<base>::factorial()
 
 	if(size() == 1) {
 		auto mult = front();
+		reserve(static_cast<std::uint64_t>(mult) * std::bit_width(mult) / (std::bit_width(true_base()) - 1) + 1); // mult! < mult^mult
 		if(mult & 1)
 			*this *= (mult >> 1) + 1;
 		for(auto diff = mult - 2; diff > 1; diff -= 2) {
@@ -235,11 +297,12 @@ constexpr BigInt<base>& BigInt<base>::factorial()
 	} else {
 #if 1 // Faster algorithm: halves the number of multiplications
 		auto mult{ clone() };
+		BigitVector<Allocator> prod_bigits(get_allocator()), scratch(get_allocator());
 		if(mult & 1)
 			*this *= (mult >> 1) + 1;
 		for(auto diff{ mult - 2 }; diff.size() > 1 || diff.front() > 1; diff -= 2) {
 			mult += diff;
-			*this *= mult;
+			__mul_eq_signless(mult, prod_bigits, scratch);
 		}
 #else // Old method
 		for(auto mult = clone() - 1; mult; --mult)
@@ -249,14 +312,14 @@ constexpr BigInt<base>& BigInt<base>::factorial()
 	return *this;
 }
 
-template<std::uint32_t base>
-constexpr std::uint64_t BigInt<base>::bits() const
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::bits() const
 {
 	return digits(2);
 }
 
-template<std::uint32_t base>
-constexpr std::uint64_t BigInt<base>::digits(const std::uint32_t smaller_base) const
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::digits(const std::uint32_t smaller_base) const
 {
 	const auto digit_base = smaller_base ? smaller_base : BASE_ZERO_TRUE_VALUE;
 	if(digit_base > true_base())
@@ -272,18 +335,23 @@ constexpr std::uint64_t BigInt<base>::digits(const std::uint32_t smaller_base) c
 		do
 			++num_digits;
 		while(last_bigit /= digit_base);
-	} else {
+	} else { // Divide by the largest power of digit_base that fits in a bigit, then count the digits of the final remainder
+		std::uint8_t digits_per_chunk;
+		const auto chunk = __max_pow_in_bigit(digit_base, digits_per_chunk);
 		num_digits = 0;
 		auto this_copy{ clone() };
+		std::uint64_t rem;
+		for(this_copy.__div_rem_eq_signless(chunk, rem); !this_copy.is_zero(); this_copy.__div_rem_eq_signless(chunk, rem))
+			num_digits += digits_per_chunk;
 		do
 			++num_digits;
-		while(this_copy /= digit_base);
+		while(rem /= digit_base);
 	}
 	return num_digits;
 }
 
-template<std::uint32_t base>
-constexpr std::uint64_t BigInt<base>::digit_sum(const std::uint32_t smaller_base) const
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::digit_sum(const std::uint32_t smaller_base) const
 {
 	const auto digit_base = smaller_base ? smaller_base : BASE_ZERO_TRUE_VALUE;
 	if(digit_base > true_base())
@@ -299,21 +367,24 @@ constexpr std::uint64_t BigInt<base>::digit_sum(const std::uint32_t smaller_base
 			while(bigit /= digit_base);
 		}
 	else {
+		std::uint8_t digits_per_chunk;
+		const auto chunk = __max_pow_in_bigit(digit_base, digits_per_chunk);
 		auto this_copy{ clone() };
+		std::uint64_t rem;
 		do {
-			const auto val = this_copy % digit_base;
-			const auto int_val = __constexpr_abs(val.to_int());
-			assert(int_val < digit_base);
-			if(limit - ds < int_val)
-				throw std::overflow_error(__THROW_INT64_OVERFLOW);
-			ds += int_val;
-		} while(this_copy /= digit_base);
+			this_copy.__div_rem_eq_signless(chunk, rem); // One short division yields digits_per_chunk digits
+			for(; rem; rem /= digit_base) {
+				if(limit - ds < rem % digit_base)
+					throw std::overflow_error(__THROW_INT64_OVERFLOW);
+				ds += rem % digit_base;
+			}
+		} while(!this_copy.is_zero());
 	}
 	return ds;
 }
 
-template<std::uint32_t base>
-constexpr std::int64_t BigInt<base>::to_int() const
+template<std::uint32_t base, typename Allocator>
+constexpr std::int64_t BigInt<base, Allocator>::to_int() const
 { // TODO fix function: should be doing ret -= bigit to allow for a result of numeric_limits<i64>::min()
 	constexpr auto limit = std::numeric_limits<std::int64_t>::max();
 	std::int64_t ret = back();
@@ -328,42 +399,92 @@ constexpr std::int64_t BigInt<base>::to_int() const
 	return positive() ? ret : -ret;
 }
 
-template<std::uint32_t base>
-constexpr std::string BigInt<base>::str(const char str_base) const
+template<std::uint32_t base, typename Allocator>
+constexpr std::string BigInt<base, Allocator>::str(const char str_base) const
 {
-	using namespace std::string_literals;
-	if(str_base < 2 || 36 < str_base)
+	std::string s(chars_needed(str_base), '\0');
+	const auto [end, ec] = to_chars(s.data(), s.data() + s.size(), str_base);
+	assert(ec == std::errc{});
+	s.resize(end - s.data());
+	return s;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::chars_needed(const int radix) const
+{ // Each bigit needs at most ceil(log_radix(B)) chars, plus one for the sign
+	if(radix < 2 || 36 < radix)
 		throw std::domain_error(__THROW_STR_BASE_DOMAIN);
-	if(is_zero()) // Prevent -0
-		return "0"s;
-
-	std::string s;
-
-	const auto chars_per_bigit = __int_log_of(true_base(), str_base);
-	if(chars_per_bigit) {
-		s = __constexpr_to_string(positive() ? back() : -static_cast<std::int64_t>(back()));
-		s.reserve(s.size() + (size() - 1) * chars_per_bigit);
-		for(const auto& bigit : bigits | __REV_DROP1_V) {
-			const auto bigit_s = __constexpr_to_string(bigit);
-			if(bigit_s.size() != chars_per_bigit)
-				s += std::string(chars_per_bigit - bigit_s.size(), '0');
-			s += bigit_s;
-		}
-	} else {
-		auto this_copy{ clone() };
-		do {
-			const auto val = this_copy % str_base;
-			const auto int_val = __constexpr_abs(val.to_int());
-			assert(int_val < str_base);
-			s.push_back(__value_to_char(static_cast<char>(int_val), str_base));
-		} while(this_copy /= str_base);
-		if(!positive())
-			s.push_back('-');
-		std::ranges::reverse(s);
+	std::size_t chars_per_bigit = 0;
+	for(std::uint64_t power = 1; power < true_base(); power *= radix)
+		++chars_per_bigit;
+	return size() * chars_per_bigit + 1;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::to_chars_result BigInt<base, Allocator>::to_chars(char* first, char* last, const int radix) const
+{
+	if(radix < 2 || 36 < radix)
+		throw std::domain_error(__THROW_STR_BASE_DOMAIN);
+	if(true_base() < static_cast<std::uint64_t>(radix)) // Radix chars wouldn't fit in a bigit: write from MAX_BASE instead
+		return BigInt<MAX_BASE, Allocator>(*this).to_chars(first, last, radix);
+	const std::to_chars_result too_large{ last, std::errc::value_too_large };
+	if(first == last)
+		return too_large;
+	if(is_zero()) { // Prevent -0
+		*first = '0';
+		return { first + 1, std::errc{} };
+	}
+	if(!positive()) {
+		*first++ = '-';
+		if(first == last)
+			return too_large;
 	}
 
-	assert(s.size());
-	return s;
+	constexpr std::size_t stack_bigits = 64;
+	char* end;
+	if(const auto chars_per_bigit = __int_log_of(true_base(), radix)) // Specialisation: B is a power of radix
+		end = __to_chars_power(first, last, bigits, radix, chars_per_bigit);
+	else if(size() <= stack_bigits) { // Specialisation: short division of a copy on the stack, no allocation
+		std::array<std::uint32_t, stack_bigits> bi_copy{};
+		std::ranges::copy(bigits, bi_copy.begin());
+		end = __to_chars_short(first, last, std::span(bi_copy).first(size()), radix, 0);
+	} else { // Split by powers of C, the largest power of radix that fits in a bigit, squaring up to about half of this value
+		std::uint8_t chars_per_chunk;
+		__BigIntVector powers(1, BigInt<base, Allocator>(static_cast<std::int64_t>(__max_pow_in_bigit(radix, chars_per_chunk)), get_allocator()), get_allocator());
+		while(size() >= __CONVERT_DC_THRESHOLD && 2 * powers.back().size() <= size())
+			powers.push_back(powers.back() * powers.back());
+		end = __to_chars_helper(first, last, std::move(clone().abs()), radix, powers, 0); // Moved, as a copy would take the default allocator
+	}
+	return end ? std::to_chars_result{ end, std::errc{} } : too_large;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::serialized_size() const noexcept
+{
+	return __SERIAL_HEADER_SIZE + size() * sizeof(std::uint32_t);
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::serialize(std::span<std::byte> out) const
+{ // Writes serialized_size() bytes to the start of out, all little-endian: the magic "BigI", version, sign (1 if negative), 2 zero bytes,
+  // base (0 for MAX_BASE) in 4 bytes and the bigit count in 8, then the bigits in 4 bytes each, least significant first. Returns the bytes written
+	const auto bytes = serialized_size();
+	if(out.size() < bytes)
+		throw std::domain_error(__THROW_SERIALIZE_SIZE_DOMAIN);
+	std::ranges::transform(__SERIAL_MAGIC, out.begin(), [](const char c) { return std::byte(c); });
+	out[4] = std::byte{ __SERIAL_VERSION };
+	out[5] = std::byte{ !positive() && !is_zero() };
+	out[6] = out[7] = std::byte{ 0 };
+	__store_le(out.subspan(8, 4), base);
+	__store_le(out.subspan(12, 8), size());
+
+	const auto limbs = out.subspan(__SERIAL_HEADER_SIZE, bytes - __SERIAL_HEADER_SIZE);
+	if(!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+		std::memcpy(limbs.data(), bigits.data(), limbs.size());
+	else
+		for(std::size_t idx = 0; const auto bigit : bigits)
+			__store_le(limbs.subspan(sizeof(std::uint32_t) * idx++, sizeof(std::uint32_t)), bigit);
+	return bytes;
 }
 
 #endif // BIG_INT_MEMBER_FUNCTIONS_HPP
@@ -1,20 +1,23 @@
 #ifndef BIG_INT_STATIC_FUNCTIONS_HPP
 #define BIG_INT_STATIC_FUNCTIONS_HPP
 
+#include <utility>
 #include <algorithm>
 #include <cassert>
 #include <stdexcept>
+#include <cstring>
+#include <bit>
 
 #include "../big_int.hpp"
 
-template<std::uint32_t base>
-constexpr std::uint64_t BigInt<base>::true_base() noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::true_base() noexcept
 {
 	return base ? base : BASE_ZERO_TRUE_VALUE;
 }
 
-template<std::uint32_t base>
-constexpr std::size_t BigInt<base>::__int_size(const std::int64_t num) noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::size_t BigInt<base, Allocator>::__int_size(const std::int64_t num) noexcept
 {
 	std::uint64_t num_copy = __constexpr_abs(num);
 	std::size_t bi_size = 1;
@@ -26,8 +29,8 @@ constexpr std::size_t BigInt<base>::__int_size(const std::int64_t num) noexcept
 	return bi_size;
 }
 
-template<std::uint32_t base>
-constexpr std::uint8_t BigInt<base>::__int_log_of(std::uint64_t eq, std::uint64_t base_val) noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint8_t BigInt<base, Allocator>::__int_log_of(std::uint64_t eq, std::uint64_t base_val) noexcept
 { // Solves x in base_val^x = eq. If eq isn't a power of base, returns 0
 	if(base_val == 0)
 		base_val = BASE_ZERO_TRUE_VALUE;
@@ -39,8 +42,109 @@ constexpr std::uint8_t BigInt<base>::__int_log_of(std::uint64_t eq, std::uint64_
 	return eq == 1 ? expo : 0;
 }
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::__valid_char(const char c, const char sv_base)
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__max_pow_in_bigit(const std::uint64_t base_val, std::uint8_t& expo) noexcept
+{ // Returns the largest power of base_val that is at most true_base() (or base_val itself, if larger), storing its exponent in expo
+	assert(1 < base_val);
+	std::uint64_t power = base_val;
+	for(expo = 1; power <= true_base() / base_val; ++expo)
+		power *= base_val;
+	return power;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__common_root(std::uint64_t a, std::uint64_t b) noexcept
+{ // Returns the largest r such that a and b are both powers of r, or 0 if there is none. Euclid's algorithm on the exponents
+	assert(a > 1 && b > 1);
+	while(a != b) {
+		if(a > b)
+			std::swap(a, b);
+		if(b % a)
+			return 0;
+		b /= a;
+	}
+	return a;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr BigInt<base, Allocator> BigInt<base, Allocator>::deserialize(std::span<const std::byte> in, const Allocator& alloc)
+{ // Reads the BigInt that serialize wrote at the start of in. Bigits of this base are copied in one go; those of another base are converted
+	std::uint32_t in_base;
+	bool in_negative;
+	const auto limbs = __serialized_bigits(in, in_base, in_negative);
+	BigitVector<Allocator> in_bigits(limbs.size() / sizeof(std::uint32_t), 0, alloc);
+	if(!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+		std::memcpy(in_bigits.data(), limbs.data(), limbs.size());
+	else
+		for(std::size_t idx = 0; auto& bigit : in_bigits)
+			bigit = static_cast<std::uint32_t>(__load_le(limbs.subspan(sizeof(std::uint32_t) * idx++, sizeof(std::uint32_t))));
+	if((in_bigits.size() > 1 && in_bigits.back() == 0) || (in_base && std::ranges::any_of(in_bigits, [in_base](const std::uint32_t bigit) { return bigit >= in_base; })))
+		throw std::domain_error(__THROW_DESERIALIZE_INVALID);
+
+	BigInt<base, Allocator> res(alloc);
+	if(in_base == base)
+		res.bigits = std::move(in_bigits);
+	else
+		res = __from_radix(in_bigits, in_base ? in_base : BASE_ZERO_TRUE_VALUE, alloc);
+	res.negative = in_negative && !res.is_zero();
+	return res;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::span<const std::byte> BigInt<base, Allocator>::__serialized_bigits(std::span<const std::byte> in, std::uint32_t& in_base, bool& in_negative)
+{ // Checks the header that serialize wrote at the start of in, returning the bytes of the bigits that follow it
+	if(in.size() < __SERIAL_HEADER_SIZE || !std::ranges::equal(in.first(__SERIAL_MAGIC.size()), __SERIAL_MAGIC, {}, {}, [](const char c) { return std::byte(c); })
+	   || in[4] != std::byte{ __SERIAL_VERSION } || in[5] > std::byte{ 1 } || in[6] != std::byte{ 0 } || in[7] != std::byte{ 0 })
+		throw std::domain_error(__THROW_DESERIALIZE_INVALID);
+	in_base = static_cast<std::uint32_t>(__load_le(in.subspan(8, 4)));
+	in_negative = in[5] == std::byte{ 1 };
+	const auto count = __load_le(in.subspan(12, 8));
+	const auto limbs = in.subspan(__SERIAL_HEADER_SIZE);
+	if(in_base == 1 || count == 0 || count > limbs.size() / sizeof(std::uint32_t))
+		throw std::domain_error(__THROW_DESERIALIZE_INVALID);
+	return limbs.first(count * sizeof(std::uint32_t));
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr typename BigInt<base, Allocator>::__FormatSpec BigInt<base, Allocator>::__parse_format_spec(const std::string_view spec)
+{ // [[fill]align][sign][#][0][width][L|'][type], as described in format_functions.hpp
+	constexpr auto is_align = [](const char c) { return c == '<' || c == '>' || c == '^'; };
+	__FormatSpec fs;
+	std::size_t idx = 0;
+	if(spec.size() >= 2 && is_align(spec[1])) {
+		fs.fill = spec[0];
+		fs.align = spec[1];
+		idx = 2;
+	} else if(!spec.empty() && is_align(spec[0]))
+		fs.align = spec[idx++];
+	if(fs.fill == '{' || fs.fill == '}')
+		throw std::domain_error(__THROW_FORMAT_SPEC_INVALID);
+	if(idx < spec.size() && (spec[idx] == '+' || spec[idx] == '-' || spec[idx] == ' '))
+		fs.sign = spec[idx++];
+	if(idx < spec.size() && spec[idx] == '#') {
+		fs.alternate = true;
+		++idx;
+	}
+	if(idx < spec.size() && spec[idx] == '0') {
+		fs.zero_pad = true;
+		++idx;
+	}
+	for(; idx < spec.size() && '0' <= spec[idx] && spec[idx] <= '9'; ++idx) {
+		fs.width = fs.width * 10 + static_cast<std::size_t>(spec[idx] - '0');
+		if(fs.width > std::numeric_limits<std::uint32_t>::max())
+			throw std::domain_error(__THROW_FORMAT_SPEC_INVALID);
+	}
+	if(idx < spec.size() && (spec[idx] == 'L' || spec[idx] == '\''))
+		fs.group = spec[idx++];
+	if(idx < spec.size() && std::string_view("bBodxX").find(spec[idx]) != std::string_view::npos)
+		fs.type = spec[idx++];
+	if(idx != spec.size())
+		throw std::domain_error(__THROW_FORMAT_SPEC_INVALID);
+	return fs;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::__valid_char(const char c, const char sv_base)
 {
 	if(sv_base < 2 || 36 < sv_base)
 		throw std::domain_error(__THROW_SV_BASE_DOMAIN);
@@ -50,8 +154,8 @@ constexpr bool BigInt<base>::__valid_char(const char c, const char sv_base)
 	));
 }
 
-template<std::uint32_t base>
-constexpr char BigInt<base>::__char_value(const char c, const char sv_base)
+template<std::uint32_t base, typename Allocator>
+constexpr char BigInt<base, Allocator>::__char_value(const char c, const char sv_base)
 {
 	if(sv_base < 2 || 36 < sv_base)
 		throw std::domain_error(__THROW_SV_BASE_DOMAIN);
@@ -62,8 +166,39 @@ constexpr char BigInt<base>::__char_value(const char c, const char sv_base)
 		: c - 'A' + 10;
 }
 
-template<std::uint32_t base>
-constexpr char BigInt<base>::__value_to_char(const char value, const char sv_base)
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__chars_value(std::string_view chars, const char sv_base)
+{ // Value of chars in sv_base, which must fit in a bigit. At runtime, decimal chars go 8 at a time through __eight_digits_value
+	std::uint32_t value = 0;
+	if(!std::is_constant_evaluated() && sv_base == 10)
+		for(std::uint32_t eight_value; chars.size() >= 8 && __eight_digits_value(chars.data(), eight_value); chars.remove_prefix(8))
+			value = value * 100'000'000 + eight_value;
+	for(const auto c : chars) { // Any invalid char is found here
+		value *= sv_base;
+		value += __char_value(c, sv_base);
+	}
+	return value;
+}
+
+template<std::uint32_t base, typename Allocator>
+bool BigInt<base, Allocator>::__eight_digits_value(const char* chars, std::uint32_t& value) noexcept
+{ // SWAR: checks and combines 8 decimal chars in one 64 bit word, loaded so that the first char is the low byte. Returns false if any char
+  // isn't a digit
+	std::uint64_t word;
+	std::memcpy(&word, chars, sizeof(word));
+	if constexpr(std::endian::native == std::endian::big)
+		word = std::byteswap(word);
+	if(((word & 0xF0F0'F0F0'F0F0'F0F0) | (((word + 0x0606'0606'0606'0606) & 0xF0F0'F0F0'F0F0'F0F0) >> 4)) != 0x3333'3333'3333'3333) // 0x30 to 0x39
+		return false;
+	word -= 0x3030'3030'3030'3030;
+	word = word * 10 + (word >> 8); // Pairs of digits, in every other byte
+	word = ((word & 0x0000'00FF'0000'00FF) * (100 + (1'000'000ULL << 32)) + ((word >> 16) & 0x0000'00FF'0000'00FF) * (1 + (10'000ULL << 32))) >> 32;
+	value = static_cast<std::uint32_t>(word);
+	return true;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr char BigInt<base, Allocator>::__value_to_char(const char value, const char sv_base)
 {
 	if(sv_base < 2 || 36 < sv_base)
 		throw std::domain_error(__THROW_SV_BASE_DOMAIN);
@@ -72,33 +207,8 @@ constexpr char BigInt<base>::__value_to_char(const char value, const char sv_bas
 	return value < 10 ? value + '0' : value - 10 + 'a';
 }
 
-template<std::uint32_t base>
-constexpr std::string BigInt<base>::__constexpr_to_string(std::int64_t num, const char sv_base)
-{
-	if(sv_base < 2 || 36 < sv_base)
-		throw std::domain_error(__THROW_SV_BASE_DOMAIN);
-
-	std::uint64_t num_copy_abs = __constexpr_abs(num);
-	std::size_t digits = 0;
-	const auto neg = num < 0;
-	do
-		++digits;
-	while(num /= sv_base);
-
-	std::string s;
-	s.resize(digits + neg);
-	for(auto& c : s | __REV_V) {
-		c = __value_to_char(num_copy_abs % sv_base, sv_base);
-		num_copy_abs /= sv_base;
-	}
-	if(neg)
-		s[0] = '-';
-	assert(s.size());
-	return s;
-}
-
-template<std::uint32_t base>
-constexpr std::uint64_t BigInt<base>::__constexpr_abs(const std::int64_t num) noexcept
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__constexpr_abs(const std::int64_t num) noexcept
 {
 	constexpr auto min_i64 = std::numeric_limits<std::int64_t>::min();
 	if(num == min_i64)
@@ -106,5 +216,102 @@ constexpr std::uint64_t BigInt<base>::__constexpr_abs(const std::int64_t num) no
 	return num < 0 ? -num : num;
 }
 
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__inverse_mod_base(const std::uint32_t num) noexcept
+{ // Solves x in num * x = 1 (mod true_base()) using the extended Euclidean algorithm. Requires gcd(num, true_base()) == 1
+	std::int64_t r_p = true_base(), r_n = num % true_base(),
+	             x_p = 0, x_n = 1;
+	while(r_n) {
+		const auto q = r_p / r_n;
+		r_p -= q * r_n;
+		std::swap(r_p, r_n);
+		x_p -= q * x_n;
+		std::swap(x_p, x_n);
+	}
+	assert(r_p == 1);
+	return x_p < 0 ? x_p + true_base() : x_p;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t BigInt<base, Allocator>::__pow_mod(std::uint64_t base_val, std::uint64_t expo, const std::uint32_t mod) noexcept
+{ // Solves base_val^expo (mod mod) by binary exponentiation
+	std::uint64_t res = 1;
+	base_val %= mod;
+	for(; expo; expo >>= 1) {
+		if(expo & 1u)
+			res = res * base_val % mod;
+		base_val = base_val * base_val % mod;
+	}
+	return res;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__mul_wide(const std::uint64_t a, const std::uint64_t b, std::uint64_t& high) noexcept
+{ // Full 64x64 -> 128 bit product: returns the low 64 bits, storing the high 64 bits in high
+#ifdef __SIZEOF_INT128__
+	const auto prod = static_cast<unsigned __int128>(a) * b;
+	high = prod >> 64;
+	return prod;
+#else
+	const std::uint64_t a_lo = a & 0xFFFF'FFFFu, a_hi = a >> 32,
+	                    b_lo = b & 0xFFFF'FFFFu, b_hi = b >> 32;
+	const auto lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+	const auto mid = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFFu) + lo_hi; // Can't overflow: at most 2(2^32 - 1) + (2^32 - 1)^2 < 2^64
+	high = hi_hi + (hi_lo >> 32) + (mid >> 32);
+	return (mid << 32) | (lo_lo & 0xFFFF'FFFFu);
+#endif
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__reciprocal_2by1(const std::uint64_t divisor) noexcept
+{ // Solves floor((B^2 - 1) / divisor) - B, for a binary base B. Requires divisor to be normalised: B / 2 <= divisor < B
+	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
+	static_assert(bits_per_bigit);
+	assert(divisor >= true_base() / 2 && divisor < true_base());
+	constexpr auto max_2by1 = bits_per_bigit == 32 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << 2 * bits_per_bigit) - 1; // B^2 - 1
+	return max_2by1 / divisor - true_base();
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__div_2by1(const std::uint64_t high, const std::uint64_t low, const std::uint64_t divisor, const std::uint64_t reciprocal, std::uint64_t& rem) noexcept
+{ // Solves (high * B + low) / divisor by Moller and Granlund's reciprocal method, for a binary base B, storing the remainder in rem.
+  // Requires divisor to be normalised, high < divisor and reciprocal == __reciprocal_2by1(divisor). Needs multiplication only, no division
+	constexpr auto bits_per_bigit = __int_log_of(true_base(), 2);
+	static_assert(bits_per_bigit);
+	assert(high < divisor && low < true_base());
+	constexpr auto mask = true_base() - 1;
+	const auto q = reciprocal * high + ((high + 1) << bits_per_bigit) + low; // Only needed mod B^2, which for B = 2^32 is the natural wraparound
+	auto q_high = (q >> bits_per_bigit) & mask;
+	const auto q_low = q & mask;
+	rem = (low - q_high * divisor) & mask;
+	if(rem > q_low) { // Estimate was at most 1 too large...
+		q_high = (q_high - 1) & mask;
+		rem = (rem + divisor) & mask;
+	}
+	if(rem >= divisor) { // ... or 1 too small
+		++q_high;
+		rem -= divisor;
+	}
+	return q_high;
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::__store_le(std::span<std::byte> out, std::uint64_t value) noexcept
+{ // Writes the low out.size() bytes of value, least significant first
+	for(auto& byte : out) {
+		byte = static_cast<std::byte>(value & 0xFF);
+		value >>= 8;
+	}
+}
+
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint64_t BigInt<base, Allocator>::__load_le(std::span<const std::byte> in) noexcept
+{ // Reads in.size() bytes, least significant first
+	std::uint64_t value = 0;
+	for(const auto byte : in | __REV_V)
+		value = value << 8 | static_cast<std::uint64_t>(byte);
+	return value;
+}
+
 #endif // BIG_INT_STATIC_FUNCTIONS_HPP
 
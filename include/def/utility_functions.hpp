@@ -4,61 +4,60 @@
 #include <algorithm>
 
 #include "../big_int.hpp"
+#include "bigit_vector_functions.hpp"
 #include "member_functions.hpp"
 #include "static_functions.hpp"
 
-template<std::uint32_t base>
-constexpr bool BigInt<base>::valid() const
+template<std::uint32_t base, typename Allocator>
+constexpr bool BigInt<base, Allocator>::valid() const
 {
-	return size() && (back() || size() == 1) && (base == 0 || std::ranges::all_of(bigits, [](const auto bigit) { // Check each bigit for validity: O(N)
-		return bigit < true_base();
-	}));
+	return __valid_bigits(bigits);
 }
 
-template<std::uint32_t base>
-constexpr void BigInt<base>::reserve(const std::size_t new_cap)
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::reserve(const std::size_t new_cap)
 {
 	return bigits.reserve(new_cap);
 }
 
-template<std::uint32_t base>
-constexpr void BigInt<base>::resize(const std::size_t count)
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::resize(const std::size_t count)
 {
 	return bigits.resize(count);
 }
 
-template<std::uint32_t base>
-constexpr void BigInt<base>::resize(const std::size_t count, const std::uint32_t value)
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::resize(const std::size_t count, const std::uint32_t value)
 {
 	return bigits.resize(count, value);
 }
 
-template<std::uint32_t base>
-constexpr void BigInt<base>::assign(const std::size_t count, const std::uint32_t value)
+template<std::uint32_t base, typename Allocator>
+constexpr void BigInt<base, Allocator>::assign(const std::size_t count, const std::uint32_t value)
 {
 	return bigits.assign(count, value);
 }
 
-template<std::uint32_t base>
-constexpr std::uint32_t& BigInt<base>::front()
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t& BigInt<base, Allocator>::front()
 {
 	return bigits.front();
 }
 
-template<std::uint32_t base>
-constexpr const std::uint32_t& BigInt<base>::front() const
+template<std::uint32_t base, typename Allocator>
+constexpr const std::uint32_t& BigInt<base, Allocator>::front() const
 {
 	return bigits.front();
 }
 
-template<std::uint32_t base>
-constexpr std::uint32_t& BigInt<base>::back()
+template<std::uint32_t base, typename Allocator>
+constexpr std::uint32_t& BigInt<base, Allocator>::back()
 {
 	return bigits.back();
 }
 
-template<std::uint32_t base>
-constexpr const std::uint32_t& BigInt<base>::back() const
+template<std::uint32_t base, typename Allocator>
+constexpr const std::uint32_t& BigInt<base, Allocator>::back() const
 {
 	return bigits.back();
 }
@@ -0,0 +1,229 @@
+#ifndef BIG_INT_VIEW_FUNCTIONS_HPP
+#define BIG_INT_VIEW_FUNCTIONS_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../big_int.hpp"
+#include "member_functions.hpp"
+#include "binary_arithmetic_operators.hpp"
+
+template<std::uint32_t base>
+constexpr BigIntView<base>::BigIntView() noexcept
+  : bigits(__ZERO_BIGITS)
+{}
+
+template<std::uint32_t base>
+template<typename Allocator>
+constexpr BigIntView<base>::BigIntView(const BigInt<base, Allocator>& bi) noexcept
+  : bigits(bi.bigits)
+  , negative(bi.negative && !bi.is_zero())
+{}
+
+template<std::uint32_t base>
+constexpr BigIntView<base>::BigIntView(std::span<const std::uint32_t> _bigits, bool _negative)
+  : bigits(_bigits)
+  , negative(_negative)
+{
+	assert(BigInt<base>::__valid_bigits(bigits));
+	negative = negative && !is_zero(); // Prevent -0
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> BigIntView<base>::operator+(const BigIntView<base>& other) const
+{ // Adds or subtracts the smaller magnitude from a copy of the larger one, reading both straight from their bigits: O(N)
+	auto larger = *this, smaller = other;
+	if(BigInt<base>::__compare_bigits(bigits, other.bigits) == BigInt<base>::__LESS_SO)
+		std::swap(larger, smaller);
+
+	auto res = larger.clone();
+	if(negative == other.negative) {
+		if(BigInt<base>::__add_bigits(res.bigits, smaller.bigits))
+			res.bigits.push_back(1);
+	} else {
+		BigInt<base>::__sub_bigits(res.bigits, smaller.bigits);
+		res.bigits.resize(BigInt<base>::__trim_bigits(res.bigits).size());
+		res.negative = res.negative && !res.is_zero();
+	}
+	assert(res.valid());
+	return res;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> BigIntView<base>::operator-(const BigIntView<base>& other) const
+{
+	return *this + BigIntView<base>(other.bigits, other.positive());
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> BigIntView<base>::operator*(const BigIntView<base>& other) const
+{ // Multiplies straight from both views' bigits, by whichever algorithm BigInt would use
+	if(is_zero() || other.is_zero())
+		return BigInt<base>();
+	const auto& a_bi = bigits.size() < other.bigits.size() ? bigits : other.bigits;
+	const auto& b_bi = bigits.size() < other.bigits.size() ? other.bigits : bigits; // a_bi is smaller than b_bi
+	BigInt<base> res;
+	res.bigits.assign(a_bi.size() + b_bi.size(), 0);
+	BigitVector<> scratch(BigInt<base>::__mul_scratch_size(a_bi.size(), b_bi.size()), 0);
+	BigInt<base>::__mul_bigits(res.bigits, a_bi, b_bi, scratch);
+	if(res.back() == 0) // Can only possibly be 1 bigit too large
+		res.bigits.pop_back();
+	res.negative = negative != other.negative;
+	assert(res.valid());
+	return res;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> BigIntView<base>::operator/(const BigIntView<base>& other) const
+{ // Division works in a copy of the dividend, and normalises a copy of the divisor, so both are copied
+	return std::move(clone() /= other.clone());
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> BigIntView<base>::operator%(const BigIntView<base>& other) const
+{ // As operator/
+	return std::move(clone() %= other.clone());
+}
+
+template<std::uint32_t base>
+constexpr bool BigIntView<base>::operator==(const BigIntView<base>& other) const noexcept
+{
+	return negative == other.negative && std::ranges::equal(bigits, other.bigits);
+}
+
+template<std::uint32_t base>
+constexpr std::strong_ordering BigIntView<base>::operator<=>(const BigIntView<base>& other) const noexcept
+{
+	if(negative != other.negative)
+		return negative ? BigInt<base>::__LESS_SO : BigInt<base>::__GREATER_SO;
+	const auto cmp = BigInt<base>::__compare_bigits(bigits, other.bigits);
+	return negative ? 0 <=> cmp : cmp;
+}
+
+template<std::uint32_t base>
+constexpr std::size_t BigIntView<base>::size() const noexcept
+{
+	return bigits.size();
+}
+
+template<std::uint32_t base>
+constexpr bool BigIntView<base>::positive() const noexcept
+{
+	return !negative;
+}
+
+template<std::uint32_t base>
+constexpr bool BigIntView<base>::is_zero() const noexcept
+{
+	return size() == 1 && bigits.front() == 0;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> BigIntView<base>::clone() const
+{
+	BigInt<base> res;
+	res.bigits.assign(bigits.begin(), bigits.end());
+	res.negative = negative;
+	return res;
+}
+
+template<std::uint32_t base>
+constexpr std::span<const std::uint32_t> BigIntView<base>::data() const noexcept
+{
+	return bigits;
+}
+
+template<std::uint32_t base>
+constexpr std::string BigIntView<base>::str(const char str_base) const
+{
+	std::string s(chars_needed(str_base), '\0');
+	const auto [end, ec] = to_chars(s.data(), s.data() + s.size(), str_base);
+	assert(ec == std::errc{});
+	s.resize(end - s.data());
+	return s;
+}
+
+template<std::uint32_t base>
+constexpr std::size_t BigIntView<base>::chars_needed(const int radix) const
+{ // As BigInt's
+	if(radix < 2 || 36 < radix)
+		throw std::domain_error(BigInt<base>::__THROW_STR_BASE_DOMAIN);
+	std::size_t chars_per_bigit = 0;
+	for(std::uint64_t power = 1; power < BigInt<base>::true_base(); power *= radix)
+		++chars_per_bigit;
+	return size() * chars_per_bigit + 1;
+}
+
+template<std::uint32_t base>
+constexpr std::to_chars_result BigIntView<base>::to_chars(char* first, char* last, const int radix) const
+{ // When B is a power of radix, the chars are read straight from the bigits. Otherwise the bigits are split by division, which needs a copy
+	if(radix < 2 || 36 < radix)
+		throw std::domain_error(BigInt<base>::__THROW_STR_BASE_DOMAIN);
+	const auto chars_per_bigit = BigInt<base>::__int_log_of(BigInt<base>::true_base(), radix);
+	if(!chars_per_bigit)
+		return clone().to_chars(first, last, radix);
+
+	const std::to_chars_result too_large{ last, std::errc::value_too_large };
+	if(first == last)
+		return too_large;
+	if(negative) {
+		*first++ = '-';
+		if(first == last)
+			return too_large;
+	}
+	if(is_zero()) {
+		*first = '0';
+		return { first + 1, std::errc{} };
+	}
+	const auto end = BigInt<base>::__to_chars_power(first, last, bigits, radix, chars_per_bigit);
+	return end ? std::to_chars_result{ end, std::errc{} } : too_large;
+}
+
+template<std::uint32_t base>
+BigIntView<base> BigIntView<base>::view_serialized(std::span<const std::byte> in)
+{ // Nothing is copied, so in must outlive the view. The bigits are checked once: O(N)
+	std::uint32_t in_base;
+	bool in_negative;
+	const auto limbs = BigInt<base>::__serialized_bigits(in, in_base, in_negative);
+	if(in_base != base || std::endian::native != std::endian::little || reinterpret_cast<std::uintptr_t>(limbs.data()) % alignof(std::uint32_t))
+		throw std::domain_error(BigInt<base>::__THROW_VIEW_SERIALIZED_DOMAIN);
+	const std::span<const std::uint32_t> view_bigits(reinterpret_cast<const std::uint32_t*>(limbs.data()), limbs.size() / sizeof(std::uint32_t));
+	if(!BigInt<base>::__valid_bigits(view_bigits))
+		throw std::domain_error(BigInt<base>::__THROW_DESERIALIZE_INVALID);
+	return BigIntView<base>(view_bigits, in_negative);
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> operator+(const BigInt<base>& bi, const BigIntView<base> view)
+{
+	return BigIntView<base>(bi) + view;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> operator-(const BigInt<base>& bi, const BigIntView<base> view)
+{
+	return BigIntView<base>(bi) - view;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> operator*(const BigInt<base>& bi, const BigIntView<base> view)
+{
+	return BigIntView<base>(bi) * view;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> operator/(const BigInt<base>& bi, const BigIntView<base> view)
+{
+	return bi / view.clone();
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> operator%(const BigInt<base>& bi, const BigIntView<base> view)
+{
+	return bi % view.clone();
+}
+
+#endif // BIG_INT_VIEW_FUNCTIONS_HPP
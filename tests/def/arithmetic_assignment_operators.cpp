@@ -38,6 +38,11 @@ consteval bool test_consteval()
 	BigInt<> bi28{ val1 };
 	BigInt<> bi29{ val2 };
 	BigInt<> bi30{ val2 };
+	BigInt<> bi31{ 0 };
+	BigInt<> bi32{ 0 };
+	BigInt<> bi33{ 0 };
+	BigInt<> bi34{ 0 };
+	BigInt<> bi35{ val1 };
 	bi1 += val2;
 	bi2 -= val2;
 	bi3 *= val2;
@@ -68,6 +73,11 @@ consteval bool test_consteval()
 	bi28 ^= "987654"s;
 	bi29 <<= "12"s;
 	bi30 >>= "12"s;
+	bi31 += val1;
+	bi32 -= val1;
+	bi33 += -123'456;
+	bi34 -= -123'456;
+	bi35 *= bi35;
 
 	ASSERT(bi1.size() == 2 && bi1.data()[0] == 966 && bi1.data()[1] == 843 && bi1.positive());
 	ASSERT(bi2.size() == 3 && bi2.data()[0] == 70 && bi2.data()[1] == 61 && bi2.data()[2] == 1 && !bi2.positive());
@@ -99,6 +109,11 @@ consteval bool test_consteval()
 	ASSERT(bi28.size() == 1 && bi28.data()[0] == 979'014 && bi28.positive());
 	ASSERT(bi29.size() == 2 && bi29.data()[0] == 45'430'784 && bi29.data()[1] == 4 && bi29.positive());
 	ASSERT(bi30.size() == 1 && bi30.data()[0] == 241 && bi30.positive());
+	ASSERT(bi31.size() == 1 && bi31.data()[0] == 123'456 && !bi31.positive());
+	ASSERT(bi32.size() == 1 && bi32.data()[0] == 123'456 && bi32.positive());
+	ASSERT(bi33.size() == 1 && bi33.data()[0] == 123'456 && !bi33.positive());
+	ASSERT(bi34.size() == 1 && bi34.data()[0] == 123'456 && bi34.positive());
+	ASSERT(bi35.size() == 2 && bi35.data()[0] == 241'383'936 && bi35.data()[1] == 15 && bi35.positive());
 	return true;
 }
 
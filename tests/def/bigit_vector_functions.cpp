@@ -0,0 +1,45 @@
+#include "../test.hpp"
+#include "../../include/def/bigit_vector_functions.hpp"
+
+consteval bool test_consteval()
+{
+	const std::array<std::uint32_t, 3> arr{ 7, 8, 9 };
+
+	BigitVector<> small(2, 5);
+	BigitVector<> large;
+	for(std::uint32_t i = 0; i != 2 * BIG_INT_INLINE_BIGITS; ++i)
+		large.push_back(i);
+	const BigitVector<> large_copy{ large };
+	BigitVector<> moved{ large_copy };
+	const BigitVector<> large_moved{ std::move(moved) };
+	BigitVector<> inserted{ arr };
+	inserted.insert(inserted.begin() + 1, 2, 0);
+	inserted.insert(inserted.end(), arr.begin(), arr.end());
+	BigitVector<> erased{ inserted };
+	erased.erase(erased.begin(), erased.begin() + 3);
+	BigitVector<> swapped1{ arr }, swapped2{ large };
+	swapped1.swap(swapped2);
+	BigitVector<> resized{ small };
+	resized.resize(BIG_INT_INLINE_BIGITS + 1, 1);
+	resized.pop_back();
+
+	ASSERT(small.size() == 2 && small[0] == 5 && small.back() == 5 && small.capacity() == BIG_INT_INLINE_BIGITS);
+	ASSERT(large.size() == 2 * BIG_INT_INLINE_BIGITS && large.front() == 0 && large.back() == 2 * BIG_INT_INLINE_BIGITS - 1);
+	ASSERT(large_copy == large && large_moved == large && moved.empty());
+	ASSERT(inserted.size() == 8 && inserted[0] == 7 && inserted[1] == 0 && inserted[2] == 0 && inserted[3] == 8 && inserted[5] == 7);
+	ASSERT(erased.size() == 5 && erased[0] == 8 && erased[1] == 9 && erased[4] == 9);
+	ASSERT(swapped1 == large && swapped2 == BigitVector<>(arr));
+	ASSERT(resized.size() == BIG_INT_INLINE_BIGITS && resized[1] == 5 && resized[2] == 1 && resized.capacity() > BIG_INT_INLINE_BIGITS);
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << "Test passed";
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
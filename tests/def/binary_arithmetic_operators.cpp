@@ -39,6 +39,27 @@ consteval bool test_consteval()
 	const BigInt<> bi29{ val2 << "12"s };
 	const BigInt<> bi30{ val2 >> "12"s };
 
+	// Rvalue operands are reused: the results are those of the const overloads, built in the operand's bigits
+	const BigInt<> big{ "123456789012345678901234567890123456789012345678901234567890", 10 }, small{ -987'654 }, neg_small{ -small };
+	BigInt<> left{ big }, right{ big }, diff_right{ big }, chain_left{ big };
+	const auto* const left_bigits = left.data().data();
+	const auto* const right_bigits = right.data().data();
+	const auto* const diff_right_bigits = diff_right.data().data();
+	const auto* const chain_left_bigits = chain_left.data().data();
+	const BigInt<> sum_left{ std::move(left) + small };
+	const BigInt<> sum_right{ small + std::move(right) };
+	const BigInt<> diff{ neg_small - std::move(diff_right) };
+	const BigInt<> chain{ -(std::move(chain_left) + small - big / 3 + small) };
+	const BigInt<> both{ (big * small) * (small * small) };
+
+	ASSERT(sum_left == big + small && sum_left.data().data() == left_bigits);
+	ASSERT(sum_right == small + big && sum_right.data().data() == right_bigits);
+	ASSERT(diff == neg_small - big && !diff.positive() && diff.data().data() == diff_right_bigits);
+	ASSERT(chain == -(big + small - big / 3 + small) && chain.data().data() == chain_left_bigits);
+	ASSERT(both == big * small * small * small);
+	ASSERT((small & BigInt<>(big)) == (big & small) && (small | BigInt<>(big)) == (big | small) && (small ^ BigInt<>(big)) == (big ^ small));
+	ASSERT(small - BigInt<>(small) == 0 && (small - BigInt<>(small)).str() == "0");
+
 	ASSERT(bi1.size() == 2 && bi1.data()[0] == 966 && bi1.data()[1] == 843 && bi1.positive());
 	ASSERT(bi2.size() == 3 && bi2.data()[0] == 70 && bi2.data()[1] == 61 && bi2.data()[2] == 1 && !bi2.positive());
 	ASSERT(bi3.size() == 4 && bi3.data()[0] == 384 && bi3.data()[1] == 243 && bi3.data()[2] == 571 && bi3.data()[3] == 113 && !bi3.positive());
@@ -35,10 +35,30 @@ consteval bool test_consteval()
 	return true;
 }
 
+bool test_runtime()
+{ // Decimal chars are read 8 at a time only at runtime
+	using namespace std::string_view_literals;
+	const BigInt bi1{ "-1234567890123456789012345"sv };
+	const BigInt<MAX_BASE> bi2{ "00000000098765432109876543210"sv };
+	const auto throws = [](const std::string_view sv) {
+		try {
+			BigInt<MAX_BASE>{ sv };
+		} catch(const std::invalid_argument&) {
+			return true;
+		}
+		return false;
+	};
+
+	ASSERT(bi1.size() == 3 && bi1.data()[0] == 789'012'345 && bi1.data()[1] == 890'123'456 && bi1.data()[2] == 1'234'567 && !bi1.positive());
+	ASSERT(bi2.size() == 3 && bi2.data()[0] == 0xE526'7EEA && bi2.data()[1] == 0x5AA5'4D38 && bi2.data()[2] == 5 && bi2.positive());
+	ASSERT(throws("1234:678901234567"sv) && throws("12345678/01234567"sv) && throws("123456789012345a"sv) && !throws("1234567890123456"sv));
+	return true;
+}
+
 int main(void)
 {
 	if constexpr(test_consteval())
-		std::cout << "Test passed";
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
 	else
 		std::cout << "Test failed";
 	std::cout << std::endl;
@@ -0,0 +1,54 @@
+#include "../test.hpp"
+#include "../../include/def/expression_functions.hpp"
+#include "../../include/def/external_functions.hpp"
+
+consteval bool test_consteval()
+{
+	using namespace std::string_literals;
+
+	const BigInt<> a{ "123456789012345678901234567890", 10 }, b{ -987'654'321 }, c{ "-555555555555555555555555555555555555", 10 }, m{ 1'000'000'007 };
+	const BigInt<MAX_BASE> x{ 0x1234'5678'9abc }, y{ -0xfedc'ba98 };
+	const BigInt<> addmul{ c + lazy(a) * b }, submul{ lazy(c) - lazy(a) * b }, commuted{ lazy(a) * b + c }, negated{ lazy(a) * b - c };
+	const BigInt<> mulmod{ lazy(a) * b % 1'000'000'007 }, mulmod_big{ lazy(a) * b % m }, summod{ (lazy(a) + b) % m };
+	const BigInt<MAX_BASE> squares{ lazy(x) * x + lazy(y) * y }, diff_squares{ lazy(x) * x - lazy(y) * y };
+	const BigInt<> nested{ lazy(a) * (lazy(b) + c) - (lazy(c) - 7) / b };
+
+	ASSERT(addmul == c + a * b && submul == c - a * b && commuted == a * b + c && negated == a * b - c);
+	ASSERT(mulmod == a * b % 1'000'000'007 && BigInt<>(lazy(a) * b % 999) == a * b % 999 && mulmod_big == a * b % m && summod == (a + b) % m);
+	ASSERT(squares == x * x + y * y && diff_squares == x * x - y * y);
+	ASSERT(nested == a * (b + c) - (c - 7) / b);
+
+	// Sign changes past the top of the accumulated bigits, and aliasing of the destination
+	BigInt<> small{ 5 }, acc{ a };
+	small = lazy(small) - lazy(a) * a;
+	acc = lazy(acc) * acc + lazy(acc) * b;
+	ASSERT(small == BigInt<>(5) - a * a && !small.positive() && acc == a * a + a * b);
+	ASSERT(BigInt<>(lazy(a) * -1 + a) == 0 && BigInt<>(lazy(a) * 0 + b) == b && BigInt<>(lazy(b) * b % 1) == 0);
+
+	// A modulus above B that is a power of it keeps the product's low bigits
+	const BigInt<10> d{ 123'456'789 }, e{ -987 };
+	const BigInt<1u << 16> f{ 0x1234'5678'9abc }, g{ 0x1'0001 };
+	ASSERT(BigInt<10>(lazy(d) * e % 1'000) == 743 && d * e % 1'000 == 743 && d % 1'000 == 789 && d / 1'000 == 123'456);
+	ASSERT(BigInt<1u << 16>(lazy(f) * g % 0x1'0000'0000) == 0xf134'9abc && f % 0x1'0000'0000 == 0x5678'9abc && f % 0x1'0000 == 0x9abc);
+	return true;
+}
+
+bool test_runtime()
+{ // Products of Karatsuba size are built beside the destination, rather than accumulated into it
+	const auto a = BigInt<MAX_BASE>(3).pow(2'000), b = -BigInt<MAX_BASE>(7).pow(1'500), c = BigInt<MAX_BASE>(11).pow(1'800);
+	const BigInt<MAX_BASE> fused{ c - lazy(a) * b }, fused_neg{ lazy(b) - lazy(a) * a }, mulmod{ lazy(a) * b % 999'999'937 };
+
+	ASSERT(fused == c - a * b && fused_neg == b - a * a && mulmod == a * b % 999'999'937);
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+#include <iterator>
+#include <string>
+
+#include "../test.hpp"
+#include "../../include/def/format_functions.hpp"
+
+template<std::uint32_t base>
+std::string format(const BigInt<base>& bi, const std::string_view spec)
+{
+	std::string s;
+	bi.format_to(std::back_inserter(s), spec);
+	return s;
+}
+
+struct group_by_3_2 : std::numpunct<char>
+{ // Indian grouping: the lowest 3 digits, then every 2
+	char do_thousands_sep() const override { return ','; }
+	std::string do_grouping() const override { return "\3\2"; }
+};
+
+bool test_runtime()
+{
+	using namespace std::string_literals;
+
+	const BigInt<> neg{ -1'234'567 };
+	const BigInt<MAX_BASE> hex{ 0x1'2345'6789 };
+	const BigInt<> zero;
+	const std::locale indian(std::locale::classic(), new group_by_3_2);
+	std::string indian_str;
+	neg.format_to(std::back_inserter(indian_str), "L", indian);
+
+	ASSERT(format(neg, "") == "-1234567"s && format(neg, "d") == "-1234567"s && format(-neg, "+") == "+1234567"s && format(-neg, " ") == " 1234567"s);
+	ASSERT(format(neg, "x") == "-12d687"s && format(neg, "#X") == "-0X12D687"s && format(neg, "o") == "-4553207"s && format(neg, "#o") == "-04553207"s);
+	ASSERT(format(hex, "#b") == "0b100100011010001010110011110001001"s && format(hex, "#x") == "0x123456789"s && format(zero, "#o") == "0"s);
+	ASSERT(format(neg, "12") == "    -1234567"s && format(neg, "*<12") == "-1234567****"s && format(neg, "*^12") == "**-1234567**"s);
+	ASSERT(format(neg, "012") == "-00001234567"s && format(hex, "#014x") == "0x000123456789"s && format(neg, "<012") == "-1234567    "s);
+	ASSERT(format(neg, "'") == "-1'234'567"s && format(hex, "'x") == "1'2345'6789"s && format(neg, "L") == "-1234567"s && indian_str == "-12,34,567"s);
+	ASSERT(format(neg, "_>14'") == "____-1'234'567"s && format(BigInt<>(123), "'") == "123"s);
+	ASSERT(format(BigInt<>(10).pow(100), "'").size() == 101 + 33 && format(BigInt<7>(-(BigInt<>(10).pow(30))), "x") == '-' + BigInt<>(10).pow(30).str(16));
+#ifdef __cpp_lib_format
+	ASSERT(std::format("{:#x} {:>10} {:'}", hex, neg, neg) == "0x123456789   -1234567 -1'234'567"s);
+#endif
+	return true;
+}
+
+int main(void)
+{
+	if(test_runtime())
+		std::cout << "Test passed";
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
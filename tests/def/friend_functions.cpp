@@ -1,4 +1,5 @@
 #include <sstream>
+#include <iomanip>
 
 #include "../test.hpp"
 #include "../../include/def/friend_functions.hpp"
@@ -16,10 +17,29 @@ bool test_runtime()
 	iss.seekg(0);
 	iss >> bi2;
 	oss << bi1 << ' ' << bi2;
+	std::ostringstream oss_flags;
+	oss_flags << std::hex << std::showbase << std::uppercase << bi1 << ' ' << std::nouppercase << std::oct << bi2 << ' ' << std::dec << std::showpos
+	          << BigInt<1024>{ 42 } << ' ' << std::setw(8) << std::setfill('_') << std::internal << bi1 << ' ' << std::left << std::setw(8) << bi1;
+	std::istringstream iss_flags{ "0x1E240 -361100 +000 0x zz"s };
+	BigInt bi5, bi6, bi7, bi8{ 7 };
+	iss_flags >> std::hex >> bi5 >> std::oct >> bi6 >> std::dec >> bi7 >> std::hex >> bi8;
+	const auto iss_flags_failed = iss_flags.fail();
+	const std::string_view chars{ "-1e240xyz" };
+	BigInt<0> bi3;
+	BigInt bi4{ 7 };
+	const auto [bi3_end, bi3_ec] = from_chars(chars.data(), chars.data() + chars.size(), bi3, 16);
+	const auto [bi4_end, bi4_ec] = from_chars(bi3_end, chars.data() + chars.size(), bi4);
 
 	ASSERT(bi1.size() == 1 && bi1.data()[0] == 123'456 && !bi1.positive());
 	ASSERT(bi2.size() == 2 && bi2.data()[0] == 576 && bi2.data()[1] == 120 && !bi2.positive());
 	ASSERT(oss.str() == "-123456 -123456"s);
+	ASSERT(oss_flags.str() == "-0X1E240 -0361100 +42 -_123456 -123456_"s);
+	ASSERT(bi5.size() == 1 && bi5.data()[0] == 123'456 && bi5.positive());
+	ASSERT(bi6.size() == 1 && bi6.data()[0] == 123'456 && !bi6.positive());
+	ASSERT(bi7.is_zero() && bi7.positive());
+	ASSERT(iss_flags_failed && bi8.size() == 1 && bi8.data()[0] == 7);
+	ASSERT(bi3_ec == std::errc{} && bi3_end == chars.data() + 6 && bi3.size() == 1 && bi3.data()[0] == 123'456 && !bi3.positive());
+	ASSERT(bi4_ec == std::errc::invalid_argument && bi4_end == chars.data() + 6 && bi4.size() == 1 && bi4.data()[0] == 7);
 	return true;
 }
 
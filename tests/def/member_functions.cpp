@@ -15,17 +15,23 @@ consteval bool test_consteval()
 	BigInt swap2{ -2 };
 	BigInt pos_abs{ pos };
 	BigInt neg_abs{ neg };
+	BigInt neg_square{ neg };
 	BigInt pos_sqrt{ pos };
+	BigInt<MAX_BASE> wide_sqrt{ 1 };
 	BigInt pos_log1{ pos };
 	BigInt pos_log2{ pos };
 	BigInt pos_log3{ pos };
 	BigInt pos_pow{ pos };
 	BigInt neg_pow1{ neg };
 	BigInt neg_pow2{ neg };
+	BigInt<MAX_BASE> wide_pow{ -3 };
 	BigInt neg_gcd1{ neg };
 	BigInt neg_gcd2{ neg };
 	BigInt neg_lcm1{ neg };
 	BigInt neg_lcm2{ neg };
+	BigInt neg_div_rem1{ neg };
+	BigInt neg_div_rem2{ neg };
+	BigInt rem1, rem2;
 	BigInt fact{ 18 };
 	BigInt neg_int{ neg };
 	const auto pos_size = pos.size();
@@ -34,22 +40,39 @@ consteval bool test_consteval()
 	const auto pos_data = pos.data();
 	const auto neg_str_dec = neg.str();
 	const auto neg_str_hex = neg.str(16);
+	const auto padded_str_dec = BigInt<1'000>(std::vector<std::uint32_t>{ 5, 70, 12 }, false).str();
+	const auto padded_str_hex = BigInt<MAX_BASE>(std::vector<std::uint32_t>{ 0xABC, 0x1F }, true).str(16);
+	const auto padded_str_quat = BigInt<MAX_BASE>(std::vector<std::uint32_t>{ 9, 6 }, false).str(4);
+	std::array<char, 8> chars{};
+	const auto [large_chars_end, large_chars_ec] = large.to_chars(chars.data(), chars.data() + chars.size(), 16);
+	const auto large_chars = std::string(chars.data(), large_chars_end);
+	const auto [small_chars_end, small_chars_ec] = large.to_chars(chars.data(), chars.data() + 3);
+	std::vector<std::byte> serialized(neg.serialized_size());
+	const auto serialized_bytes = neg.serialize(serialized);
+	const auto deserialized = BigInt<>::deserialize(serialized);
+	const auto deserialized_1024 = BigInt<1024>::deserialize(serialized);
 	pos.sign(false);
 	neg.sign(true);
 	swap1.swap(swap2);
 	pos_abs.abs();
 	neg_abs.abs();
+	neg_square.square();
 	pos_sqrt.sqrt();
+	wide_sqrt <<= 128;
+	wide_sqrt.sqrt();
 	pos_log1.log(three);
 	pos_log2.log(3);
 	pos_log3.log("3"s);
 	pos_pow.pow(three);
 	neg_pow1.pow(3);
 	neg_pow2.pow("3"s);
+	wide_pow.pow(41);
 	neg_gcd1.gcd(large);
 	neg_gcd2.gcd("987654"s);
 	neg_lcm1.lcm(large);
 	neg_lcm2.lcm("987654"s);
+	neg_div_rem1.div_rem(large, rem1);
+	neg_div_rem2.div_rem<DivisionType::FLOORED>(1'000, rem2);
 	fact.factorial();
 
 	ASSERT(pos_size == 1);
@@ -62,17 +85,22 @@ consteval bool test_consteval()
 	ASSERT(pos_data.size() == 1 && pos_data[0] == 123'456);
 	ASSERT(pos_abs.size() == 1 && pos_abs.data()[0] == 123'456 && pos_abs.positive());
 	ASSERT(neg_abs.size() == 1 && neg_abs.data()[0] == 123'456 && neg_abs.positive());
+	ASSERT(neg_square.size() == 2 && neg_square.data()[0] == 241'383'936 && neg_square.data()[1] == 15 && neg_square.positive());
 	ASSERT(pos_sqrt.size() == 1 && pos_sqrt.data()[0] == 351 && pos_sqrt.positive());
+	ASSERT(wide_sqrt.size() == 3 && wide_sqrt.data()[0] == 0 && wide_sqrt.data()[1] == 0 && wide_sqrt.data()[2] == 1);
 	ASSERT(pos_log1.size() == 1 && pos_log1.data()[0] == 10 && pos_log1.positive());
 	ASSERT(pos_log2.size() == 1 && pos_log2.data()[0] == 10 && pos_log2.positive());
 	ASSERT(pos_log3.size() == 1 && pos_log3.data()[0] == 10 && pos_log3.positive());
 	ASSERT(pos_pow.size() == 2 && pos_pow.data()[0] == 295'202'816 && pos_pow.data()[1] == 1'881'640 && pos_pow.positive());
 	ASSERT(neg_pow1.size() == 2 && neg_pow1.data()[0] == 295'202'816 && neg_pow1.data()[1] == 1'881'640 && !neg_pow1.positive());
 	ASSERT(neg_pow2.size() == 2 && neg_pow2.data()[0] == 295'202'816 && neg_pow2.data()[1] == 1'881'640 && !neg_pow2.positive());
+	ASSERT(wide_pow.size() == 3 && wide_pow.data()[0] == 0x7B5F'B863 && wide_pow.data()[1] == 0xFA2A'1CF6 && wide_pow.data()[2] == 1 && !wide_pow.positive());
 	ASSERT(neg_gcd1.size() == 1 && neg_gcd1.data()[0] == 6 && neg_gcd1.positive());
 	ASSERT(neg_gcd2.size() == 1 && neg_gcd2.data()[0] == 6 && neg_gcd2.positive());
 	ASSERT(neg_lcm1.size() == 2 && neg_lcm1.data()[0] == 321'968'704 && neg_lcm1.data()[1] == 20 && neg_lcm1.positive());
 	ASSERT(neg_lcm2.size() == 2 && neg_lcm2.data()[0] == 321'968'704 && neg_lcm2.data()[1] == 20 && neg_lcm2.positive());
+	ASSERT(neg_div_rem1.is_zero() && rem1.size() == 1 && rem1.data()[0] == 123'456 && !rem1.positive());
+	ASSERT(neg_div_rem2.size() == 1 && neg_div_rem2.data()[0] == 124 && !neg_div_rem2.positive() && rem2.size() == 1 && rem2.data()[0] == 544 && rem2.positive());
 	ASSERT(fact.size() == 2 && fact.data()[0] == 705'728'000 && fact.data()[1] == 6'402'373 && fact.positive());
 	ASSERT(large.bits() == 20);
 	ASSERT(large.digits() == 6);
@@ -81,6 +109,13 @@ consteval bool test_consteval()
 	ASSERT(large.digit_sum(16) == 24);
 	ASSERT(neg_int.to_int() == -123'456);
 	ASSERT(neg_str_dec == "-123456"s && neg_str_hex == "-1e240"s);
+	ASSERT(padded_str_dec == "12070005"s && padded_str_hex == "-1f00000abc"s && padded_str_quat == "120000000000000021"s);
+	ASSERT(large_chars_ec == std::errc{} && large_chars == "f1206"s);
+	ASSERT(small_chars_ec == std::errc::value_too_large && small_chars_end == chars.data() + 3);
+	ASSERT(serialized_bytes == 24 && serialized[4] == std::byte{ 1 } && serialized[5] == std::byte{ 1 } && serialized[20] == std::byte{ 0x40 });
+	ASSERT(deserialized.size() == 1 && deserialized.data()[0] == 123'456 && !deserialized.positive());
+	ASSERT(deserialized_1024.size() == 2 && deserialized_1024.data()[0] == 576 && deserialized_1024.data()[1] == 120 && !deserialized_1024.positive());
+	ASSERT(large.chars_needed() == 10 && large.chars_needed(16) == 9);
 	return true;
 }
 
@@ -0,0 +1,50 @@
+#include "../test.hpp"
+#include "../../include/def/view_functions.hpp"
+
+consteval bool test_consteval()
+{
+	using namespace std::string_literals;
+
+	const BigInt pos{ 123'456'789'012 };
+	const BigInt neg{ -987'654 };
+	const std::array<std::uint32_t, 2> pos_bigits{ 456'789'012, 123 };
+	const BigIntView pos_view{ pos_bigits, false };
+	const BigIntView neg_view{ neg };
+	const BigIntView<> zero_view;
+	const BigInt<MAX_BASE> hex{ 0x1'2345'6789 };
+
+	ASSERT(pos_view == pos && neg_view == neg && zero_view == 0_bi && pos_view != neg_view);
+	ASSERT(neg_view < zero_view && zero_view < pos_view && pos > neg_view && neg_view >= neg);
+	ASSERT(pos_view.size() == 2 && pos_view.positive() && !neg_view.positive() && zero_view.is_zero() && pos_view.data()[1] == 123);
+	ASSERT(pos_view + neg_view == pos + neg && neg_view + pos_view == neg + pos && neg_view + neg == neg + neg);
+	ASSERT(pos_view - neg_view == pos - neg && neg_view - pos == neg - pos && pos_view - pos == 0_bi && (pos_view - pos).positive());
+	ASSERT(pos_view * neg_view == pos * neg && neg * neg_view == neg * neg && pos_view * zero_view == 0_bi);
+	ASSERT(pos_view / neg_view == pos / neg && pos % neg_view == pos % neg);
+	ASSERT(pos_view.clone() == pos && neg_view.str() == "-987654"s && pos_view.str(16) == "1cbe991a14"s);
+	ASSERT(BigIntView(hex).str(16) == "123456789"s && BigIntView(-hex).str(2) == '-' + hex.str(2) && BigIntView(hex).chars_needed(16) == 17);
+	return true;
+}
+
+bool test_runtime()
+{ // Only at runtime: the bytes are reinterpreted as bigits
+	const auto bi = -(BigInt<MAX_BASE>(7).pow(1'000));
+	std::vector<std::uint32_t> storage((bi.serialized_size() + 3) / sizeof(std::uint32_t)); // Aligned for the bigits
+	const auto bytes = std::as_writable_bytes(std::span(storage));
+	bi.serialize(bytes);
+	const auto view = BigIntView<MAX_BASE>::view_serialized(bytes);
+
+	ASSERT(view == bi && view.data().data() == storage.data() + 5);
+	ASSERT(view * view == bi * bi && view.str() == bi.str());
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
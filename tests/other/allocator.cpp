@@ -0,0 +1,168 @@
+#include <memory_resource>
+#include <new>
+
+#include "../test.hpp"
+#include "../../include/def/constructors.hpp"
+#include "../../include/def/arithmetic_assignment_operators.hpp"
+#include "../../include/def/binary_arithmetic_operators.hpp"
+#include "../../include/def/comparison_operators.hpp"
+#include "../../include/def/external_functions.hpp"
+
+template<typename T>
+struct TaggedAllocator
+{ // Stateful, and never propagated on assignment, as std::pmr::polymorphic_allocator
+	using value_type = T;
+	int tag = 0;
+
+	constexpr TaggedAllocator() = default;
+	constexpr TaggedAllocator(const int _tag)
+	  : tag(_tag)
+	{}
+	template<typename U>
+	constexpr TaggedAllocator(const TaggedAllocator<U>& other)
+	  : tag(other.tag)
+	{}
+
+	constexpr T* allocate(const std::size_t n)
+	{
+		return std::allocator<T>{}.allocate(n);
+	}
+	constexpr void deallocate(T* p, const std::size_t n)
+	{
+		std::allocator<T>{}.deallocate(p, n);
+	}
+	template<typename U>
+	constexpr bool operator==(const TaggedAllocator<U>& other) const noexcept
+	{
+		return tag == other.tag;
+	}
+};
+
+std::size_t global_allocations = 0;
+
+void* operator new(const std::size_t size)
+{ // Counts every allocation through std::allocator, or anything else not given a memory resource
+	++global_allocations;
+	if(void* const p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* const p) noexcept
+{
+	std::free(p);
+}
+void operator delete(void* const p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+struct CountingResource : std::pmr::memory_resource
+{ // Counts allocations, taking memory straight from malloc so as not to be counted by operator new
+	std::size_t allocations = 0;
+
+private:
+	void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+	{
+		++allocations;
+		if(void* const p = std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment))
+			return p;
+		throw std::bad_alloc();
+	}
+	void do_deallocate(void* const p, std::size_t, std::size_t) override
+	{
+		std::free(p);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+consteval bool test_consteval()
+{
+	using TaggedBigInt = BigInt<DEFAULT_BASE, TaggedAllocator<std::uint32_t>>;
+	const TaggedAllocator<std::uint32_t> alloc1{ 1 }, alloc2{ 2 };
+	const TaggedBigInt a{ "123456789012345678901234567890", 10, alloc1 };
+	const TaggedBigInt b{ -987'654'321, alloc2 };
+	TaggedBigInt assigned{ alloc2 }, moved{ alloc2 };
+	assigned = a;
+	moved = a * a;
+	const auto [q, r] = divmod(a, b);
+	const BigInt<MAX_BASE, TaggedAllocator<std::uint32_t>> converted{ a };
+
+	ASSERT((a + b).get_allocator() == alloc1 && (b * a).get_allocator() == alloc2 && (-a).get_allocator() == alloc1);
+	ASSERT(q.get_allocator() == alloc1 && r.get_allocator() == alloc1 && q * b + r == a);
+	ASSERT(assigned == a && assigned.get_allocator() == alloc2 && moved == a * a && moved.get_allocator() == alloc2);
+	ASSERT(TaggedBigInt(a, alloc2).get_allocator() == alloc2 && a.clone().get_allocator() == alloc1);
+	ASSERT(converted.get_allocator() == alloc1 && TaggedBigInt(converted) == a);
+	return true;
+}
+
+bool test_runtime()
+{ // Every bigit of a result lives in the monotonic buffer, however many temporaries were made on the way. With the default resource
+  // unable to allocate, no temporary may have escaped to it either
+	std::array<std::byte, 16'384> buffer;
+	std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+	const auto old_default = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+	const pmr::BigInt<> a{ "-123456789012345678901234567890", 10, &arena };
+	const auto square = a * a;
+	const pmr::BigInt<MAX_BASE> converted{ square };
+	auto power{ a.clone() }, root{ square.clone() }, fact{ pmr::BigInt<>(60, &arena) };
+	power.pow(5);
+	root.sqrt();
+	fact.factorial();
+	std::pmr::vector<pmr::BigInt<>> numbers{ &arena };
+	numbers.emplace_back(a);
+	numbers.emplace_back(12'345);
+	std::pmr::set_default_resource(old_default);
+
+	ASSERT(square.get_allocator().resource() == &arena && square == a * a && square.str() == "15241578753238836750495351562536198787501905199875019052100");
+	ASSERT(converted.get_allocator().resource() == &arena && pmr::BigInt<>(converted) == square);
+	ASSERT(power.get_allocator().resource() == &arena && power == a * a * a * a * a && root == -a);
+	ASSERT(fact.get_allocator().resource() == &arena && fact.str() == "8320987112741390144276341183223364380754172606361245952449277696409600000000000000");
+	ASSERT(numbers[0].get_allocator().resource() == &arena && numbers[1].get_allocator().resource() == &arena && numbers[0] == a);
+
+	// Operands long enough for Toom-Cook multiplication and recursive division take every temporary from their own resource, a bounded number
+	// of times per operation, and nothing from operator new
+	CountingResource counting;
+	pmr::BigInt<> x{ 3, &counting }, y{ 7, &counting }, z{ 11, &counting };
+	x.pow(6'000); // About 320 bigits
+	y.pow(4'000);
+	z.pow(1'000);
+	std::string prod_chars((x * y).chars_needed(16), '\0');
+	const auto old_global = global_allocations;
+	std::pmr::set_default_resource(std::pmr::null_memory_resource());
+	auto before = counting.allocations;
+	const auto prod = x * y;
+	const auto mul_allocations = counting.allocations - before;
+	before = counting.allocations;
+	const auto quot = prod / z, rem = prod % z;
+	const auto div_allocations = counting.allocations - before;
+	before = counting.allocations;
+	auto z_power{ z.clone() };
+	z_power.pow(64); // 6 squarings, into about 7'500 bigits
+	const auto pow_allocations = counting.allocations - before;
+	const pmr::BigInt<MAX_BASE> prod_converted{ prod };
+	const auto prod_end = prod.to_chars(prod_chars.data(), prod_chars.data() + prod_chars.size(), 16).ptr;
+	std::pmr::set_default_resource(old_default);
+
+	ASSERT(global_allocations == old_global);
+	ASSERT(mul_allocations <= 3 && div_allocations <= 10 && pow_allocations <= 6);
+	ASSERT(prod.get_allocator().resource() == &counting && quot.get_allocator().resource() == &counting && z_power.get_allocator().resource() == &counting);
+	ASSERT(quot * z + rem == prod && rem < z && prod / y == x && prod % y == 0);
+	auto z_check{ z.clone() };
+	z_check.pow(8);
+	ASSERT(z_power == z_check.pow(8) && pmr::BigInt<>(prod_converted) == prod && std::string_view(prod_chars.data(), prod_end) == prod.str(16));
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+#include <sstream>
+
+#include "../test.hpp"
+#include "../../include/def/constructors.hpp"
+#include "../../include/def/arithmetic_assignment_operators.hpp"
+#include "../../include/def/binary_arithmetic_operators.hpp"
+#include "../../include/def/comparison_operators.hpp"
+#include "../../include/def/member_functions.hpp"
+#include "../../include/def/friend_functions.hpp"
+
+template<std::uint32_t from_base, std::uint32_t to_base>
+constexpr bool test_convert(const std::size_t n)
+{ // B^n and B^n - 1 agree with powers found by multiplication, and survive a round trip
+	const auto power = power_of_base<from_base>(n);
+	const auto expected = BigInt<to_base>(static_cast<std::int64_t>(BigInt<from_base>::true_base())).pow(static_cast<std::int64_t>(n));
+	const auto max = -(power - 1);
+	const BigInt<to_base> power_converted{ power }, max_converted{ max };
+	return power_converted == expected && max_converted == -(expected - 1) && BigInt<from_base>(max_converted) == max;
+}
+
+template<std::uint32_t base>
+constexpr bool test_string(const char sv_base, const std::size_t n)
+{ // "1000...0" and "-zzz...z" with n zeros or z's (z being sv_base - 1) agree with powers found by multiplication, both ways
+	const auto power = BigInt<base>(sv_base).pow(static_cast<std::int64_t>(n));
+	const auto max_char = static_cast<char>(sv_base <= 10 ? '0' + sv_base - 1 : 'a' + sv_base - 11);
+	const auto power_str = '1' + std::string(n, '0'), max_str = '-' + std::string(n, max_char);
+	return BigInt<base>(power_str, sv_base) == power && BigInt<base>(max_str, sv_base) == -(power - 1) &&
+	       power.str(sv_base) == power_str && (-(power - 1)).str(sv_base) == max_str;
+}
+
+template<std::uint32_t base>
+bool test_stream(const std::size_t n)
+{ // As test_string for sv_base 10, through the stream operators, which write and read in pieces
+	const auto power = BigInt<base>(10).pow(static_cast<std::int64_t>(n));
+	const auto power_str = '1' + std::string(n, '0'), max_str = '-' + std::string(n, '9');
+	std::ostringstream oss;
+	oss << power << ' ' << -(power - 1);
+	std::istringstream iss{ oss.str() };
+	BigInt<base> power_read, max_read;
+	iss >> power_read >> max_read;
+	return oss.str() == power_str + ' ' + max_str && power_read == power && max_read == -(power - 1) && iss.eof() && !iss.fail();
+}
+
+template<std::uint32_t from_base, std::uint32_t to_base>
+constexpr bool test_serialize(const std::size_t n)
+{ // -(B^n - 1) survives serialize and deserialize, into its own base and another
+	const auto max = -(power_of_base<from_base>(n) - 1);
+	std::vector<std::byte> bytes(max.serialized_size() + 3); // Trailing bytes are ignored
+	max.serialize(bytes);
+	return BigInt<from_base>::deserialize(bytes) == max && BigInt<to_base>::deserialize(bytes) == BigInt<to_base>(max);
+}
+
+template<std::uint32_t from_base, std::uint32_t to_base>
+constexpr bool test_random_convert(TestRandom& rng, const std::size_t threshold)
+{ // Random values either side of a threshold, and a few levels of splitting above it, survive a round trip to another base and through strings
+  // in radix 10 and 7. The residue modulo a prime, found separately in each base, checks that the converted value is right rather than just invertible
+	for(const auto size : { threshold - 1, threshold, threshold + 1, 2 * threshold + 1, 5 * threshold - 2 }) {
+		const auto x = random_big_int<from_base>(rng, size);
+		const BigInt<to_base> converted{ x };
+		if(BigInt<from_base>(converted) != x || converted % 1'000'000'007 != BigInt<to_base>(x % 1'000'000'007))
+			return false;
+		for(const char radix : { 10, 7 })
+			if(BigInt<from_base>(x.str(radix), radix) != x || BigInt<to_base>(x.str(radix), radix) != converted)
+				return false;
+	}
+	return true;
+}
+
+consteval bool test_consteval()
+{ // A few bigits each: longer values exceed the compiler's default constexpr operation limit, so are in test_runtime
+	ASSERT((test_convert<DEFAULT_BASE, MAX_BASE>(8)));
+	ASSERT((test_convert<MAX_BASE, DEFAULT_BASE>(8)));
+	ASSERT((test_convert<3, 10>(10)));
+	ASSERT((test_convert<1000, 7>(6)));
+	ASSERT((test_convert<10, DEFAULT_BASE>(10))); // Power-related bases are regrouped directly
+	ASSERT((test_convert<DEFAULT_BASE, 10>(5)));
+	ASSERT((test_convert<65'536, MAX_BASE>(10)));
+	ASSERT((test_convert<MAX_BASE, 8>(5)));
+	ASSERT(test_string<MAX_BASE>(10, 50));
+	ASSERT(test_string<DEFAULT_BASE>(16, 50));
+	ASSERT(test_string<MAX_BASE>(7, 30));
+	ASSERT((test_serialize<MAX_BASE, DEFAULT_BASE>(8)));
+	return true;
+}
+
+bool test_runtime()
+{ // Too large for constant evaluation: many levels of recursive splitting
+	ASSERT((test_convert<DEFAULT_BASE, MAX_BASE>(100)));
+	ASSERT((test_convert<MAX_BASE, DEFAULT_BASE>(100)));
+	ASSERT((test_convert<3, 10>(150)));
+	ASSERT((test_convert<1000, 7>(40)));
+	ASSERT((test_convert<10, DEFAULT_BASE>(200)));
+	ASSERT((test_convert<DEFAULT_BASE, 10>(50)));
+	ASSERT((test_convert<65'536, MAX_BASE>(100)));
+	ASSERT((test_convert<MAX_BASE, 8>(20)));
+	ASSERT(test_string<MAX_BASE>(10, 1'000));
+	ASSERT(test_string<DEFAULT_BASE>(16, 500));
+	ASSERT(test_string<MAX_BASE>(7, 300));
+	ASSERT(test_string<MAX_BASE>(16, 100));
+	ASSERT((test_serialize<MAX_BASE, DEFAULT_BASE>(50)));
+	ASSERT((test_convert<DEFAULT_BASE, MAX_BASE>(20'000)));
+	ASSERT((test_convert<MAX_BASE, DEFAULT_BASE>(20'000)));
+	ASSERT(test_string<MAX_BASE>(10, 200'000));
+	ASSERT(test_stream<MAX_BASE>(100'000));
+	ASSERT(test_stream<DEFAULT_BASE>(20'000));
+	ASSERT((test_serialize<MAX_BASE, DEFAULT_BASE>(5'000)));
+	ASSERT((test_serialize<DEFAULT_BASE, 7>(1'000)));
+
+	// Random values at the threshold, between binary, decimal and unrelated small bases
+	TestRandom rng{ 0x2545'f491'4f6c'dd1d };
+	ASSERT((test_random_convert<MAX_BASE, DEFAULT_BASE>(rng, BIG_INT_CONVERT_DC_THRESHOLD)));
+	ASSERT((test_random_convert<DEFAULT_BASE, MAX_BASE>(rng, BIG_INT_CONVERT_DC_THRESHOLD)));
+	ASSERT((test_random_convert<MAX_BASE, 10>(rng, BIG_INT_CONVERT_DC_THRESHOLD)));
+	ASSERT((test_random_convert<1000, 7>(rng, BIG_INT_CONVERT_DC_THRESHOLD)));
+	ASSERT((test_random_convert<65'536, 3>(rng, BIG_INT_CONVERT_DC_THRESHOLD)));
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
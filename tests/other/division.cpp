@@ -0,0 +1,107 @@
+#include "../test.hpp"
+#include "../../include/def/constructors.hpp"
+#include "../../include/def/arithmetic_assignment_operators.hpp"
+#include "../../include/def/binary_arithmetic_operators.hpp"
+#include "../../include/def/comparison_operators.hpp"
+#include "../../include/def/external_functions.hpp"
+
+template<std::uint32_t base>
+constexpr bool test_div(const std::size_t m, const std::size_t n)
+{ // (q * d + (d - 1)) / d = q, with remainder d - 1, for a divisor with a small top bigit and one with every bigit at its maximum
+	const auto q = power_of_base<base>(m) - 1;
+	const std::array<BigInt<base>, 2> divisors{ power_of_base<base>(n) + 12'345, power_of_base<base>(n + 1) - 1 };
+	for(const auto& d : divisors) {
+		const auto r = d - 1,
+		           a = q * d + r;
+		if(a / d != q || a % d != r)
+			return false;
+	}
+	return true;
+}
+
+template<std::uint32_t base>
+constexpr bool test_divmod(const std::size_t m, const std::size_t n)
+{ // Every rounding, for every sign combination, satisfies a = q * d + r with |r| < |d| and the right sign of r
+	const auto a_abs = power_of_base<base>(m) - 12'345,
+	           d_abs = power_of_base<base>(n) + 54'321;
+	for(const auto a_neg : { false, true })
+		for(const auto d_neg : { false, true }) {
+			auto a{ a_abs }, d{ d_abs };
+			a.sign(!a_neg);
+			d.sign(!d_neg);
+			const auto [q_trunc, r_trunc] = divmod(a, d);
+			const auto [q_floor, r_floor] = divmod<DivisionType::FLOORED>(a, d);
+			const auto [q_euclid, r_euclid] = divmod<DivisionType::EUCLIDEAN>(a, d);
+			if(q_trunc != a / d || q_trunc * d + r_trunc != a || q_floor * d + r_floor != a || q_euclid * d + r_euclid != a)
+				return false;
+			if(r_trunc.positive() == a_neg || r_floor.positive() == d_neg || !r_euclid.positive())
+				return false;
+			if(BigInt<base>(r_trunc).abs() >= d_abs || BigInt<base>(r_floor).abs() >= d_abs || r_euclid >= d_abs)
+				return false;
+		}
+	return true;
+}
+
+template<std::uint32_t base>
+constexpr bool test_random_div(TestRandom& rng, const std::size_t threshold)
+{ // Random divisors and quotients either side of a threshold, and quotients over twice as long as the divisor, give a = q * d + r with |r| < |d|
+	for(const auto d_size : { threshold - 1, threshold, threshold + 1 })
+		for(const auto q_size : { threshold - 1, threshold, threshold + 1, 2 * threshold + 3 }) {
+			const auto a = random_big_int<base>(rng, q_size + d_size), d = random_big_int<base>(rng, d_size);
+			const auto [q, r] = divmod(a, d);
+			if(q != a / d || q * d + r != a || BigInt<base>(r).abs() >= BigInt<base>(d).abs() || (!r.is_zero() && r.positive() != a.positive()))
+				return false;
+		}
+	return true;
+}
+
+consteval bool test_consteval()
+{
+	ASSERT(test_div<MAX_BASE>(3, 1));
+	ASSERT(test_div<MAX_BASE>(20, 10));
+	ASSERT(test_div<MAX_BASE>(10, 25));
+	ASSERT(test_div<1024>(15, 9));
+	ASSERT(test_div<2>(40, 30));
+	ASSERT(test_div<DEFAULT_BASE>(10, 5));
+	ASSERT(test_div<10>(30, 12));
+	ASSERT(test_div<7>(20, 8));
+	ASSERT(test_divmod<MAX_BASE>(12, 5));
+	ASSERT(test_divmod<MAX_BASE>(3, 0));
+	ASSERT(test_divmod<DEFAULT_BASE>(8, 3));
+	ASSERT(divmod<DivisionType::FLOORED>(-7_bi, 2) == std::pair(-4_bi, 1_bi));
+	ASSERT(divmod<DivisionType::EUCLIDEAN>(-7_bi, -2) == std::pair(4_bi, 1_bi));
+
+	TestRandom rng{ 0x9e37'79b9'7f4a'7c15 };
+	ASSERT(test_random_div<MAX_BASE>(rng, BIG_INT_DIV_DC_THRESHOLD));
+	return true;
+}
+
+bool test_runtime()
+{ // Too large for constant evaluation: Burnikel-Ziegler and Newton division
+	ASSERT(test_div<MAX_BASE>(300, 200));
+	ASSERT(test_div<DEFAULT_BASE>(200, 150));
+	ASSERT(test_div<MAX_BASE>(500, 120));
+	ASSERT(test_div<MAX_BASE>(1000, 1000));
+	ASSERT(test_div<MAX_BASE>(33'000, 33'000));
+	ASSERT(test_div<DEFAULT_BASE>(33'000, 33'000));
+
+	// Random operands at both thresholds, in a binary, a decimal and a small base
+	TestRandom rng{ 0x2545'f491'4f6c'dd1d };
+	ASSERT(test_random_div<MAX_BASE>(rng, BIG_INT_DIV_DC_THRESHOLD));
+	ASSERT(test_random_div<DEFAULT_BASE>(rng, BIG_INT_DIV_DC_THRESHOLD));
+	ASSERT(test_random_div<10>(rng, BIG_INT_DIV_DC_THRESHOLD));
+	ASSERT(test_random_div<MAX_BASE>(rng, BIG_INT_DIV_NEWTON_THRESHOLD));
+	ASSERT(test_random_div<DEFAULT_BASE>(rng, BIG_INT_DIV_NEWTON_THRESHOLD));
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+#include "../test.hpp"
+#include "../../include/def/constructors.hpp"
+#include "../../include/def/arithmetic_assignment_operators.hpp"
+#include "../../include/def/binary_arithmetic_operators.hpp"
+#include "../../include/def/comparison_operators.hpp"
+
+template<std::uint32_t base>
+constexpr bool test_mul(const std::size_t m, const std::size_t n)
+{ // (base^m - 1) * (base^n - 1) = base^(m + n) - base^m - base^n + 1
+	const auto a = power_of_base<base>(m) - 1,
+	           b = power_of_base<base>(n) - 1;
+	const auto expected = power_of_base<base>(m + n) - power_of_base<base>(m) - power_of_base<base>(n) + 1;
+	return a * b == expected && b * a == expected;
+}
+
+template<std::uint32_t base>
+constexpr bool test_sqr(const std::size_t n)
+{ // (base^n - 1)^2 = base^2n - 2 * base^n + 1, via square(), self-aliasing *= and pow()
+	auto a = power_of_base<base>(n) - 1, b = a, c = a;
+	const auto expected = power_of_base<base>(2 * n) - power_of_base<base>(n) - power_of_base<base>(n) + 1;
+	a.square();
+	b *= b;
+	c.pow(2);
+	return a == expected && b == expected && c == expected;
+}
+
+template<std::uint32_t base>
+constexpr BigInt<base> schoolbook_mul(const BigInt<base>& a, const BigInt<base>& b)
+{ // The product by the textbook O(N^2) method, straight from both operands' bigits
+	const auto true_base = BigInt<base>::true_base();
+	const auto a_bi = a.data(), b_bi = b.data();
+	std::vector<std::uint32_t> bigits(a_bi.size() + b_bi.size(), 0);
+	for(std::size_t i = 0; i != a_bi.size(); ++i) {
+		std::uint64_t carry = 0;
+		for(std::size_t j = 0; j != b_bi.size(); ++j) { // Can't overflow: (B - 1)^2 + 2(B - 1) < B^2
+			carry += static_cast<std::uint64_t>(a_bi[i]) * b_bi[j] + bigits[i + j];
+			bigits[i + j] = carry % true_base;
+			carry /= true_base;
+		}
+		bigits[i + b_bi.size()] = carry;
+	}
+	if(bigits.back() == 0)
+		bigits.pop_back();
+	return BigInt<base>(bigits, a.positive() != b.positive()); // Neither is zero
+}
+
+template<std::uint32_t base>
+constexpr bool test_random_mul(TestRandom& rng, const std::size_t threshold, const bool unbalanced = true)
+{ // Random operands either side of a threshold, balanced and (optionally) with each Toom-Cook variant's shape, against schoolbook multiplication
+	for(const auto a_size : { threshold - 1, threshold, threshold + 1 }) {
+		std::vector<std::size_t> b_sizes{ a_size, a_size + 1 };
+		if(unbalanced)
+			b_sizes.insert(b_sizes.end(), { 7 * a_size / 4, 3 * a_size, 5 * a_size });
+		for(const auto b_size : b_sizes) {
+			const auto a = random_big_int<base>(rng, a_size), b = random_big_int<base>(rng, b_size);
+			const auto expected = schoolbook_mul(a, b);
+			if(a * b != expected || b * a != expected)
+				return false;
+		}
+		const auto a = random_big_int<base>(rng, a_size);
+		if(a * a != schoolbook_mul(a, a))
+			return false;
+	}
+	return true;
+}
+
+consteval bool test_consteval()
+{ // Long multiplication, and a single Karatsuba product: more would exceed the compiler's default constexpr operation limit
+	ASSERT(test_mul<MAX_BASE>(5, 7));
+	ASSERT(test_mul<MAX_BASE>(40, 40));
+	ASSERT(test_sqr<MAX_BASE>(7));
+	ASSERT((power_of_base<MAX_BASE>(5) - 1) * 0x7FFF'FFFF'FFFF'FFFF == (power_of_base<MAX_BASE>(5) - 1) * BigInt<MAX_BASE>(0x7FFF'FFFF'FFFF'FFFF));
+	return true;
+}
+
+bool test_runtime()
+{ // Too large for constant evaluation: unbalanced Karatsuba, Toom-3, Toom-32, Toom-42, Toom-4 and NTT
+	ASSERT(test_mul<MAX_BASE>(33, 101));
+	ASSERT(test_mul<DEFAULT_BASE>(40, 40));
+	ASSERT(test_mul<DEFAULT_BASE>(35, 80));
+	ASSERT(test_mul<10>(64, 65));
+	ASSERT(test_sqr<DEFAULT_BASE>(45));
+	ASSERT(test_sqr<10>(33));
+	ASSERT(test_mul<MAX_BASE>(260, 300));
+	ASSERT(test_mul<DEFAULT_BASE>(270, 420));
+	ASSERT(test_mul<MAX_BASE>(260, 600));
+	ASSERT(test_mul<MAX_BASE>(800, 900));
+	ASSERT(test_mul<DEFAULT_BASE>(1000, 1000));
+	ASSERT(test_mul<MAX_BASE>(3000, 3000));
+	ASSERT(test_mul<DEFAULT_BASE>(2500, 7000));
+	ASSERT(test_mul<10>(2100, 2200));
+	ASSERT(test_sqr<MAX_BASE>(300));
+	ASSERT(test_sqr<DEFAULT_BASE>(1000));
+	ASSERT(test_sqr<MAX_BASE>(2500));
+	ASSERT(test_mul<MAX_BASE>(6200, 6300));
+	ASSERT(test_sqr<MAX_BASE>(6200));
+
+	// Random operands at every threshold, in a binary, a decimal and a small base
+	TestRandom rng{ 0x2545'f491'4f6c'dd1d };
+	for(const auto threshold : { BIG_INT_KARATSUBA_THRESHOLD, BIG_INT_TOOM3_THRESHOLD, BIG_INT_TOOM4_THRESHOLD }) {
+		ASSERT(test_random_mul<MAX_BASE>(rng, threshold));
+		ASSERT(test_random_mul<DEFAULT_BASE>(rng, threshold));
+		ASSERT(test_random_mul<10>(rng, threshold));
+	}
+	ASSERT(test_random_mul<MAX_BASE>(rng, BIG_INT_NTT_THRESHOLD_MAX_BASE, false));
+	ASSERT(test_random_mul<DEFAULT_BASE>(rng, BIG_INT_NTT_THRESHOLD, false));
+	ASSERT(test_random_mul<10>(rng, BIG_INT_NTT_THRESHOLD, false));
+	return true;
+}
+
+int main(void)
+{
+	if constexpr(test_consteval())
+		std::cout << (test_runtime() ? "Test passed" : "Test failed");
+	else
+		std::cout << "Test failed";
+	std::cout << std::endl;
+
+	return EXIT_SUCCESS;
+}
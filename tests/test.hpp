@@ -1,5 +1,6 @@
 #include <iostream>
 #include <cstdlib>
+#include <vector>
 
 #include "../include/big_int.hpp"
 
@@ -12,3 +13,42 @@
 consteval bool test_consteval();
 bool test_runtime();
 
+
+template<std::uint32_t base>
+constexpr BigInt<base> power_of_base(const std::size_t expo)
+{ // Returns base^expo, built without multiplication
+	std::vector<std::uint32_t> bigits(expo + 1, 0);
+	bigits.back() = 1;
+	return BigInt<base>(std::move(bigits), false);
+}
+
+struct TestRandom
+{ // Seeded xorshift64, usable in constant evaluation, so that every run checks the same operands
+	std::uint64_t state;
+
+	constexpr std::uint64_t operator()() noexcept
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+template<std::uint32_t base>
+constexpr BigInt<base> random_big_int(TestRandom& rng, const std::size_t size)
+{ // A value of exactly size bigits, negative half the time. Some have most bigits B - 1, or only 0 and B - 1, to reach long carries and corrections
+	const auto true_base = BigInt<base>::true_base();
+	const auto kind = rng() % 3;
+	std::vector<std::uint32_t> bigits(size);
+	for(auto& bigit : bigits)
+		if(kind == 0)
+			bigit = rng() % true_base;
+		else if(kind == 1)
+			bigit = rng() % 8 ? true_base - 1 : rng() % true_base;
+		else
+			bigit = rng() & 1 ? true_base - 1 : 0;
+	if(bigits.back() == 0)
+		bigits.back() = 1;
+	return BigInt<base>(bigits, rng() & 1);
+}